@@ -0,0 +1,4 @@
+@ECHO OFF
+SET PATH=%PATH%;.\lib\raylib5.5-win64\lib;
+
+%*
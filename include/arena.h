@@ -0,0 +1,26 @@
+#ifndef _ARENA_
+#define _ARENA_
+
+#include <stddef.h>
+
+// Bump allocator. Everything allocated from an arena is freed at once by
+// ResetArena or UnloadArena. A zeroed Arena is ready to use. Not thread-safe:
+// only one thread may allocate from an arena at a time.
+typedef struct Arena {
+    struct ArenaBlock *blocks; // Newest first.
+    size_t blockSize;          // 0 for ARENA_DEFAULT_BLOCK_SIZE.
+    size_t reserved;           // Bytes held by all blocks.
+} Arena;
+
+#define ARENA_DEFAULT_BLOCK_SIZE 4096
+
+// Aligned for any type. A NULL arena allocates from the heap instead, so
+// the caller frees the result itself.
+void *ArenaAlloc(Arena *arena, size_t size);
+void *ArenaCalloc(Arena *arena, size_t count, size_t size);
+
+// Frees everything but one block, which is kept for the next allocations.
+void ResetArena(Arena *arena);
+void UnloadArena(Arena *arena);
+
+#endif
@@ -0,0 +1,52 @@
+#ifndef _CPL_PREAD_
+#define _CPL_PREAD_
+
+#include <stdio.h>
+
+// Positional read, so any number of threads can read through the same FILE*
+// at once. Bypasses stdio's buffer. On Windows, ReadFile moves the handle's
+// file pointer even when given an offset, so fseek before reading the FILE*
+// through stdio again.
+
+#ifdef _WIN32
+
+#include <cpl_raylib.h>
+#include <io.h>
+
+static inline long long pread_file(FILE *f, void *buf, size_t size, unsigned long long offset)
+{
+    HANDLE file = (HANDLE)_get_osfhandle(_fileno(f));
+    OVERLAPPED overlapped = { 0 };
+    DWORD read = 0;
+
+    overlapped.Offset = (DWORD)offset;
+    overlapped.OffsetHigh = (DWORD)(offset >> 32);
+
+    if (!ReadFile(file, buf, (DWORD)size, &read, &overlapped) && GetLastError() != ERROR_HANDLE_EOF) return -1;
+
+    return read;
+}
+
+#else
+
+#include <unistd.h>
+
+static inline long long pread_file(FILE *f, void *buf, size_t size, unsigned long long offset)
+{
+    size_t done = 0;
+
+    // pread may return short counts; keep going until EOF or an error.
+    while (done < size)
+    {
+        ssize_t n = pread(fileno(f), (char *)buf + done, size - done, offset + done);
+        if (n < 0) return -1;
+        if (n == 0) break;
+        done += n;
+    }
+
+    return done;
+}
+
+#endif
+
+#endif
@@ -46,26 +46,57 @@ static void pthread_join(pthread_t thread, void **ret)
     *ret = exitCode;
 }
 
-typedef HANDLE pthread_mutex_t;
+// Slim reader/writer locks rather than critical sections, so mutexes and
+// condition variables can be initialized statically like on POSIX.
+typedef SRWLOCK pthread_mutex_t;
+
+#define PTHREAD_MUTEX_INITIALIZER SRWLOCK_INIT
 
 static void pthread_mutex_init(pthread_mutex_t *mutex, void *attr)
 {
-    *mutex = CreateMutex(NULL, FALSE, "opensc5_threadpool_worker");
+    InitializeSRWLock(mutex);
 }
 
 static void pthread_mutex_lock(pthread_mutex_t *mutex)
 {
-    WaitForSingleObject(*mutex, INFINITE);
+    AcquireSRWLockExclusive(mutex);
 }
 
 static void pthread_mutex_unlock(pthread_mutex_t *mutex)
 {
-    ReleaseMutex(*mutex);
+    ReleaseSRWLockExclusive(mutex);
 }
 
 static void pthread_mutex_destroy(pthread_mutex_t *mutex)
 {
-    CloseHandle(*mutex);
+}
+
+typedef CONDITION_VARIABLE pthread_cond_t;
+
+#define PTHREAD_COND_INITIALIZER CONDITION_VARIABLE_INIT
+
+static void pthread_cond_init(pthread_cond_t *cond, void *attr)
+{
+    InitializeConditionVariable(cond);
+}
+
+static void pthread_cond_wait(pthread_cond_t *cond, pthread_mutex_t *mutex)
+{
+    SleepConditionVariableSRW(cond, mutex, INFINITE, 0);
+}
+
+static void pthread_cond_signal(pthread_cond_t *cond)
+{
+    WakeConditionVariable(cond);
+}
+
+static void pthread_cond_broadcast(pthread_cond_t *cond)
+{
+    WakeAllConditionVariable(cond);
+}
+
+static void pthread_cond_destroy(pthread_cond_t *cond)
+{
 }
 
 #else
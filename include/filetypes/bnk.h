@@ -3,6 +3,7 @@
 
 #include <stdbool.h>
 #include <raylib.h>
+#include "arena.h"
 
 typedef struct BnkData {
     unsigned int pointsTo;
@@ -13,5 +14,7 @@ typedef struct BnkData {
 } BnkData;
 
 BnkData LoadBnkData(unsigned char *data, int dataSize);
+// The waves array comes from arena; the samples of each wave still need UnloadWave.
+BnkData LoadBnkDataInArena(unsigned char *data, int dataSize, Arena *arena);
 
 #endif
@@ -0,0 +1,69 @@
+#ifndef _DBPF_
+#define _DBPF_
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+// On-disk layout of DBPF packages, shared by the reader and the writer.
+
+typedef struct PackageHeader {
+    char magic[4];              //00
+    uint32_t majorVersion;      //04
+    uint32_t minorVersion;      //08
+    uint32_t unknown[3];        //0C
+    uint32_t dateCreated;       //18
+    uint32_t dateModified;      //1C
+    uint32_t indexMajorVersion; //20
+    uint32_t indexEntryCount;   //24
+    uint32_t firstIndexEntryOffset; //28
+    uint32_t indexSize;         //2C
+    uint32_t holeEntryCount;    //30
+    uint32_t holeOffset;        //34
+    uint32_t holeSize;          //38
+    uint32_t indexMinorVersion; //3C
+    uint32_t indexOffset;       //40
+    uint32_t unknown2;          //44
+    unsigned char reserved[24]; //48
+                                //5C
+} PackageHeader;
+
+typedef struct IndexEntry {
+    uint32_t type;
+    uint32_t group;
+    uint32_t instance;
+    uint32_t chunkOffset;
+    uint32_t diskSize;
+    uint32_t memSize;
+    uint16_t compressed;
+    uint16_t unknown;
+    
+    bool isCompressed;
+} IndexEntry;
+
+typedef struct IndexData {
+    uint32_t null;
+} IndexData;
+
+typedef struct Index {
+    uint32_t indexType;
+    
+    IndexData data;
+} Index;
+
+struct PackageEntry;
+
+// Shared by LoadPackageFile and the package stream.
+
+// Reads the header at the start of f and the index it points to.
+IndexEntry *ReadPackageIndex(FILE *f, PackageHeader *header);
+// Entry indices sorted by chunkOffset, so the file is read front to back.
+int *SortByChunkOffset(IndexEntry *entries, int count);
+void SetPackageEntryChunk(struct PackageEntry *pkgEntry, IndexEntry entry, unsigned char *chunk);
+void DecodePackageEntry(struct PackageEntry *pkgEntry);
+// Marks a decoded entry PKGENTRY_LOADED and wakes the threads waiting for it.
+void PublishPackageEntryData(struct PackageEntry *pkgEntry);
+// Blocks until the thread decoding the entry publishes it.
+void WaitForPackageEntryData(struct PackageEntry *pkgEntry);
+
+#endif
@@ -0,0 +1,47 @@
+#ifndef _ENTRYCACHE_
+#define _ENTRYCACHE_
+
+#include <stddef.h>
+#include <stdbool.h>
+#include "package.h"
+
+// Process-wide record of decoded entries, one per PackageEntry. When the
+// decoded data goes over the budget, entries that are not pinned are unloaded
+// again (CLOCK order: entries used since the hand last passed get a second
+// chance).
+
+typedef struct EntryCacheStats {
+    unsigned long hits;
+    unsigned long misses;
+    unsigned long evictions;
+
+    size_t size;        // Bytes of decoded data, see GetPackageEntryDataSize.
+    size_t budget;
+    int entryCount;
+    int pinnedCount;
+} EntryCacheStats;
+
+// Unlimited until set.
+void SetEntryCacheBudget(size_t budget);
+
+// Decodes the entry if needed and pins it until ReleasePackageEntryData.
+// May unload other entries to stay within budget, so call it from the thread
+// that owns their textures.
+PackageEntry *AcquirePackageEntryData(Package pkg, int i);
+void ReleasePackageEntryData(PackageEntry *entry);
+
+// Decodes the entry into the cache without unloading anything, so it is safe
+// from any thread. Returns false once the cache is over budget.
+bool PrefetchPackageEntryData(Package pkg, int i);
+
+// Unloads unpinned entries until the cache is within budget. Same thread
+// rules as AcquirePackageEntryData.
+void TrimEntryCache(void);
+
+// Forgets pkg's entries, pinned or not. Call before UnloadPackageFile, and
+// before MergePackages moves them.
+void RemovePackageFromEntryCache(Package pkg);
+
+EntryCacheStats GetEntryCacheStats(void);
+
+#endif
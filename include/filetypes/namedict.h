@@ -0,0 +1,71 @@
+#ifndef _NAMEDICT_
+#define _NAMEDICT_
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "mapfile.h"
+#include "prop.h"
+
+// Reverse lookup of TheHash. Candidate names are gathered from wordlists,
+// Properties.txt and the text of package entries (MUiLE JSON, scripts,
+// string properties), hashed, and kept as one sorted table that is saved
+// as is and mapped back in, so loading it parses nothing.
+
+#define NAMEDICT_FILENAME "names.dict"
+#define NAMEDICT_BUCKET_BITS 16
+#define NAMEDICT_MAX_NAME 255
+
+typedef struct NameDictHeader {
+    char magic[4];          // "OSND"
+    uint32_t version;
+    uint32_t nameCount;
+    uint32_t stringsSize;
+} NameDictHeader;
+
+// Layout: header, buckets[(1 << NAMEDICT_BUCKET_BITS) + 1], hashes[nameCount],
+// offsets[nameCount], strings[stringsSize]. Hashes are sorted; the ones whose
+// top bits are b sit between buckets[b] and buckets[b + 1].
+typedef struct NameDict {
+    MappedFile mapping;     // Set when loaded from a file.
+    unsigned char *data;    // Set when built in memory.
+    const NameDictHeader *header;
+    const uint32_t *buckets;
+    const uint32_t *hashes;
+    const uint32_t *offsets; // Into strings, per hash.
+    const char *strings;
+} NameDict;
+
+typedef struct NameDictBuilder NameDictBuilder;
+
+NameDictBuilder *CreateNameDictBuilder(void);
+// Hashes every candidate across the threadpool and frees the builder.
+NameDict BuildNameDict(NameDictBuilder *builder);
+
+// Exact duplicates are dropped as they come in.
+void AddNameCandidate(NameDictBuilder *builder, const char *name, int length);
+// For names whose id is not their hash, like most of Properties.txt.
+void AddNamedId(NameDictBuilder *builder, uint32_t id, const char *name);
+void AddPropertyNames(NameDictBuilder *builder, PropertyNameList nameList);
+// One name per line. Here and in text, paths are also added without their
+// directory and without their extension.
+bool AddNameWordlist(NameDictBuilder *builder, const char *filename);
+// Every identifier or path in text.
+void AddNamesFromText(NameDictBuilder *builder, const char *text, size_t size);
+// Streams the package and harvests its text entries and string properties.
+// Returns the entries visited.
+int AddNamesFromPackageFile(NameDictBuilder *builder, FILE *f);
+
+NameDict LoadNameDict(const char *filename);
+bool SaveNameDict(NameDict dict, const char *filename);
+void UnloadNameDict(NameDict dict);
+
+// NULL when no name in dict hashes to hash. Of several, the first one added wins.
+const char *LookupNameDict(NameDict dict, uint32_t hash);
+int GetNameDictCount(NameDict dict);
+
+// Process-wide dictionary behind LookupName, e.g. for exporters. NULL for none.
+void SetNameDict(const NameDict *dict);
+const char *LookupName(uint32_t hash);
+
+#endif
@@ -8,6 +8,10 @@
 #include "rast.h"
 #include "bnk.h"
 #include "rw4.h"
+#include "mapfile.h"
+#include "refpack.h"
+#include "threadpool.h"
+#include "arena.h"
 
 #define PKGENTRY_PROP 0x00B1B104 // PROPerties file
 #define PKGENTRY_GMDL 0x00E6BCE5 // Unknown. Found in a property file enumerating type codes.
@@ -41,12 +45,21 @@
 #define PKGENTRY_HTML 0xDD6233D6 // HyperText Markup Language
 #define PKGENTRY_SWB  0xEA5118B0 // SWarm Binary file, particles. Unable to be viewed in-editor.
 
+// PackageEntry.loadState
+#define PKGENTRY_UNLOADED 0 // Only the index stub is known; see GetPackageEntryData.
+#define PKGENTRY_LOADING  1
+#define PKGENTRY_LOADED   2
+
 typedef struct PackageEntry {
     unsigned int type;
     unsigned int group;
     unsigned int instance;
     bool corrupted;
     bool compressed;
+    bool ownsDataRaw; // dataRaw is a copy made by ReplacePackageEntryData.
+    unsigned char loadState;
+
+    unsigned int chunkOffset; // Where the entry's data starts in its package file.
 
     unsigned char *dataRaw;
     int dataRawSize;
@@ -54,6 +67,9 @@ typedef struct PackageEntry {
     unsigned char *dataCompressed;
     int dataCompressedSize;
 
+    Arena arena; // Everything decoding allocated, including a decompressed dataRaw.
+    struct PackageEntry *shared; // Owner of dataRaw and data when they are shared with identical entries, see pkgdedup.h.
+
     union {
         PropData propData;
         RulesData rulesData;
@@ -76,30 +92,46 @@ typedef struct PackageEntry {
 typedef struct Package {
     unsigned int entryCount;
     PackageEntry *entries;
+
+    MappedFile mapping; // Only set when loaded with PKGLOAD_MMAP.
+    Arena arena; // Chunk copies of packages that are not mapped.
+    struct PackageIndex *index; // TGI lookup tables, see pkgindex.h.
 } Package;
 
+// LoadPackageFileEx flags.
+#define PKGLOAD_MMAP (1 << 0) // Map the file; dataCompressed/dataRaw point into the mapping instead of being copied.
+#define PKGLOAD_LAZY (1 << 1) // Only read the index; entries are decoded on their first GetPackageEntryData. Implies PKGLOAD_MMAP.
+#define PKGLOAD_STDIO (1 << 2) // Read chunks with fseek/fread under one lock instead of positional reads. Only kept for comparison.
+
 Package LoadPackageFile(FILE *f);
+Package LoadPackageFileEx(FILE *f, int flags);
+// Loads entries as tasks of group. If the group is cancelled, entries that
+// were not read yet are marked corrupted.
+Package LoadPackageFileInGroup(FILE *f, int flags, TaskGroup *group);
 void UnloadPackageFile(Package pkg);
 
-void ExportPackageEntry(PackageEntry entry, const char *filename);
+// Decodes the entry on first use. Safe to call from several threads at once.
+PackageEntry *GetPackageEntryData(Package pkg, int i);
+// Frees what decoding the entry allocated, including uploaded textures, so
+// the next GetPackageEntryData decodes it again.
+void UnloadPackageEntryData(PackageEntry *entry);
+// Replaces the entry's contents with an uncompressed copy of data and decodes it again.
+// Call from the thread that owns the entry's textures.
+void ReplacePackageEntryData(Package pkg, int i, const unsigned char *data, int size);
+// Bytes held by the entry's decoded data, textures included. Data shared with
+// identical entries counts as an even share.
+size_t GetPackageEntryDataSize(const PackageEntry *entry);
 
-typedef struct PackageSearchParams {
-    bool searchInstance;
-    bool searchGroup;
-    bool searchType;
-
-    char *instance;
-    char *group;
-    char *type;
-} PackageSearchParams;
-
-int *SearchPackage(Package pkg, PackageSearchParams params, int *nResults);
-
-void MergePackages(Package *dest, Package src);
+void ExportPackageEntry(PackageEntry entry, const char *filename);
+// "name.ext", with the instance's name from the name dictionary (see
+// namedict.h) or its id. Path separators in names become underscores.
+void GetPackageEntryFileName(PackageEntry entry, char *buf, int size);
 void SetWriteCorruptedPackageEntries(bool val);
 
-void ExportPackage(Package pkg, const char *filename);
-
 unsigned char *DecompressDBPF(unsigned char *data, int dataSize, int outDataSize);
+// Same, into a buffer of outDataSize bytes. Returns false on a malformed stream.
+bool DecompressDBPFInto(unsigned char *data, int dataSize, unsigned char *out, int outDataSize);
+// Returns NULL if the compressed data would not be smaller than dataSize.
+unsigned char *CompressDBPF(unsigned char *data, int dataSize, int *outDataSize, int level);
 
 #endif
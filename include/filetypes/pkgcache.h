@@ -0,0 +1,82 @@
+#ifndef _PKGCACHE_
+#define _PKGCACHE_
+
+#include <stdint.h>
+#include "package.h"
+#include "resmgr.h"
+
+// On-disk copy of the indexes of a set of packages, so a warm start can skip
+// reading every package's DBPF index. A cached package is only trusted while
+// the file on disk still has the size and modification time it was cached with.
+// Besides each package's entries and lookup tables, the cache holds the TGI
+// table of all of them merged in order, which a resource manager searches
+// straight from the mapping.
+
+typedef struct PackageCacheHeader {
+    char magic[4];          // "OSCI"
+    uint32_t version;
+    uint32_t packageCount;
+    uint32_t entryCount;
+    uint32_t stringsSize;
+    uint32_t pathSlotCount; // Always a power of two.
+    uint32_t resourceCount;
+    uint32_t indexSize;     // In int32_t.
+} PackageCacheHeader;
+
+typedef struct PackageCacheFile {
+    uint64_t size;
+    int64_t mtime;          // In nanoseconds, or whole seconds where stat has nothing finer.
+    uint32_t pathOffset;    // Into the string table.
+    uint32_t firstEntry;
+    uint32_t entryCount;
+    uint32_t indexOffset;   // Into index: slots[slotCount], byType[entryCount], byGroup[entryCount].
+    uint32_t slotCount;     // See PackageIndex.
+    uint32_t reserved;
+} PackageCacheFile;
+
+typedef struct PackageCacheEntry {
+    uint32_t type;
+    uint32_t group;
+    uint32_t instance;
+    uint32_t chunkOffset;
+    uint32_t diskSize;
+    uint32_t memSize;
+    uint32_t compressed;
+} PackageCacheEntry;
+
+// Layout: header, files[packageCount], pathSlots[pathSlotCount],
+// entries[entryCount], resources[resourceCount], index[indexSize],
+// strings[stringsSize]. pathSlots is an open addressing table of file
+// positions (-1 when empty) by HashData64 of the path. resources is sorted by
+// TGI, with the package's position in files as the layer.
+typedef struct PackageCache {
+    MappedFile mapping;
+    const PackageCacheHeader *header;
+    const PackageCacheFile *files;
+    const int32_t *pathSlots;
+    const PackageCacheEntry *entries;
+    const ResourceSlot *resources;
+    const int32_t *index;
+    const char *strings;
+} PackageCache;
+
+PackageCache LoadPackageCache(const char *filename);
+void UnloadPackageCache(PackageCache cache);
+
+// Returns the cached package for path, or -1 if it is missing or stale.
+int FindCachedPackage(PackageCache cache, const char *path);
+// True when the cache holds exactly these packages, in this order, and none
+// of them changed on disk since.
+bool IsPackageCacheCurrent(PackageCache cache, const char **paths, int count);
+
+// Opens the package index-only (like PKGLOAD_LAZY) from the cached index.
+Package LoadCachedPackage(PackageCache cache, int cached, const char *path);
+// Adds every cached package to the empty mgr, named by its path, and hands it
+// the merged TGI table; the cache gives up its mapping to mgr. Only valid when
+// IsPackageCacheCurrent. Returns false, leaving mgr empty, if a package could
+// not be opened.
+bool LoadCachedResources(ResourceManager *mgr, PackageCache *cache);
+
+bool SavePackageCache(const char *filename, const char **paths, const Package *pkgs, int count);
+
+#endif
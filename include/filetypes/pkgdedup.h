@@ -0,0 +1,40 @@
+#ifndef _PKGDEDUP_
+#define _PKGDEDUP_
+
+#include <stddef.h>
+#include <stdbool.h>
+#include "package.h"
+
+// Compressed entries with the same type and the same compressed bytes are
+// decoded once: the first decode goes into a shared entry, later ones copy its
+// dataRaw and data and keep a reference until UnloadPackageEntryData. Only
+// textures stay per entry. Candidates are found by a 64-bit hash of the bytes
+// plus both sizes, then compared byte for byte against the first entry's
+// chunk, which is not copied.
+
+typedef struct PackageDedupStats {
+    unsigned long lookups;      // Decodes that went through the table.
+    unsigned long duplicates;   // Of those, ones that reused a shared entry.
+    unsigned long collisions;   // Ones whose hash matched but whose bytes did not.
+    size_t savedBytes;          // Decompressed bytes the duplicates did not allocate.
+    int sharedCount;            // Shared entries currently held.
+} PackageDedupStats;
+
+// Off by default: a package on its own rarely repeats an entry, and each
+// lookup costs a hash and a shared entry. Worth it when loading several
+// packages that overlap. Only affects entries decoded afterwards.
+void SetDeduplicatePackageEntries(bool val);
+bool IsPackageDedupEnabled(void);
+
+// Returns the shared entry for entry's compressed bytes and takes a reference.
+// When *decode is set the caller is the first one and has to decode it, then
+// call PublishSharedEntry; otherwise it is already decoded.
+PackageEntry *AcquireSharedEntry(const PackageEntry *entry, bool *decode);
+void PublishSharedEntry(PackageEntry *shared);
+// Drops user's reference and unloads the shared entry with the last one.
+void ReleaseSharedEntry(PackageEntry *shared, const PackageEntry *user);
+int GetSharedEntryRefCount(const PackageEntry *shared);
+
+PackageDedupStats GetPackageDedupStats(void);
+
+#endif
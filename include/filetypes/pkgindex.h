@@ -0,0 +1,43 @@
+#ifndef _PKGINDEX_
+#define _PKGINDEX_
+
+#include <stdint.h>
+#include "package.h"
+
+// Lookup tables over a package's entries, built by LoadPackageFile and kept up
+// to date by MergePackages. When a (type, group, instance) key appears more
+// than once, the entry added last wins.
+typedef struct PackageIndex {
+    unsigned int entryCount; // Number of entries indexed so far.
+
+    unsigned int slotCount;  // Open addressing table, always a power of two.
+    int *slots;              // Entry index per slot, -1 when empty.
+
+    int *byType;             // Entry indices sorted by type, group, instance.
+    int *byGroup;            // Entry indices sorted by group, type, instance.
+} PackageIndex;
+
+static inline unsigned int HashTGI(unsigned int type, unsigned int group, unsigned int instance)
+{
+    uint64_t h = instance * 0x9E3779B97F4A7C15ull;
+    h ^= (((uint64_t)group << 32) | type) * 0xC2B2AE3D27D4EB4Full;
+    h ^= h >> 29;
+    return (unsigned int)(h ^ (h >> 32));
+}
+
+PackageIndex *BuildPackageIndex(const PackageEntry *entries, unsigned int entryCount);
+void ExtendPackageIndex(PackageIndex *index, const PackageEntry *entries, unsigned int entryCount);
+void FreePackageIndex(PackageIndex *index);
+// Copies an index saved from slots, byType and byGroup of another one over
+// the same entries (see pkgcache.h) instead of hashing and sorting again.
+// Returns NULL if they are not a valid index of entryCount entries.
+PackageIndex *LoadPackageIndex(unsigned int entryCount, unsigned int slotCount, const int32_t *slots, const int32_t *byType, const int32_t *byGroup);
+
+// Returns the entry's position in pkg.entries, or -1.
+int FindPackageEntry(Package pkg, unsigned int type, unsigned int group, unsigned int instance);
+
+// Return a contiguous run of entry positions; *count is set to its length.
+const int *GetPackageEntriesByType(Package pkg, unsigned int type, int *count);
+const int *GetPackageEntriesByGroup(Package pkg, unsigned int group, int *count);
+
+#endif
@@ -0,0 +1,29 @@
+#ifndef _PKGSEARCH_
+#define _PKGSEARCH_
+
+#include <stdbool.h>
+#include "package.h"
+
+// Finding entries: by TGI prefix, by type name, and across several packages
+// merged into one.
+
+// The PKGENTRY_* name without the prefix, or NULL for unknown types.
+const char *GetPackageEntryTypeName(unsigned int type);
+
+typedef struct PackageSearchParams {
+    bool searchInstance;
+    bool searchGroup;
+    bool searchType;
+
+    char *instance;
+    char *group;
+    char *type;
+} PackageSearchParams;
+
+int *SearchPackage(Package pkg, PackageSearchParams params, int *nResults);
+
+// dest takes over src's entries; src's mapping and chunk copies must stay
+// until dest is unloaded, so only free(src.entries) afterwards.
+void MergePackages(Package *dest, Package src);
+
+#endif
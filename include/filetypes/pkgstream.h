@@ -0,0 +1,26 @@
+#ifndef _PKGSTREAM_
+#define _PKGSTREAM_
+
+#include <stdio.h>
+#include <stdbool.h>
+#include "package.h"
+
+// Walks a package's entries in file order, decoding a few at a time into a
+// fixed set of reusable buffers. Each entry is released before the stream
+// moves past it, so scanning any number of packages runs in constant memory.
+typedef struct PackageStream PackageStream;
+
+// Reads the index of f, which must stay open until the stream is closed.
+PackageStream *OpenPackageStream(FILE *f);
+void ClosePackageStream(PackageStream *stream);
+
+// Returns the next entry in file order, or NULL once all of them were visited.
+// The entry and its decoded data are only valid until the next call.
+PackageEntry *NextPackageEntry(PackageStream *stream);
+int GetPackageStreamEntryCount(PackageStream *stream);
+
+// Calls fn on every entry of f in file order, releasing each one once fn
+// returns. Stops early when fn returns false. Returns the entries visited.
+int ScanPackageFile(FILE *f, bool (*fn)(PackageEntry *entry, void *ctx), void *ctx);
+
+#endif
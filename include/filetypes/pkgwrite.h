@@ -0,0 +1,14 @@
+#ifndef _PKGWRITE_
+#define _PKGWRITE_
+
+#include "package.h"
+
+// Entries are RefPack compressed at REFPACK_BALANCED; ExportPackageEx takes a
+// REFPACK_* level, or 0 to store every entry uncompressed. Entries are
+// compressed on the threadpool and streamed to the file in order, so only a
+// few entries are held in memory at a time. Entries are read from worker
+// threads, so nothing may unload them while the package is exported.
+void ExportPackage(Package pkg, const char *filename);
+void ExportPackageEx(Package pkg, const char *filename, int level);
+
+#endif
@@ -2,6 +2,7 @@
 #define _PROP_
 
 #include <cpl_raylib.h>
+#include "arena.h"
 
 #define PROPVAR_BOOL   0x01
 #define PROPVAR_INT32  0x09
@@ -64,14 +65,22 @@ typedef struct PropData {
 } PropData;
 
 PropData LoadPropData(unsigned char *data, int dataSize);
+// Allocates the variables from arena, so they are freed with it.
+PropData LoadPropDataInArena(unsigned char *data, int dataSize, Arena *arena);
+// Only for PropData from LoadPropData.
+void UnloadPropData(PropData propData);
 
-// Properties.txt.
+// Properties.txt, sorted by id.
 typedef struct PropertyNameList {
-    unsigned long *propIds;
-    const char **propNames;
+    const unsigned long *propIds;
+    const char *const *propNames;
     int propCount;
 } PropertyNameList;
 
 PropertyNameList LoadPropertyNameList(const char *filename);
+// The Properties.txt shipped with the editor, compiled in; see propnames.h.
+PropertyNameList GetBuiltinPropertyNameList(void);
+// NULL if id is not in the list. The first name in file order wins.
+const char *FindPropertyName(PropertyNameList nameList, unsigned long id);
 
 #endif
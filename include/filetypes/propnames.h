@@ -0,0 +1,405 @@
+// Generated by gen_propnames from Properties.txt and include/filetypes/package.h. Do not edit.
+
+#ifndef _PROPNAMES_
+#define _PROPNAMES_
+
+#define PROP_packageSignature 0x00000000
+#define PROP_MRT 0x00000041
+#define PROP_RenderTargetCorrection 0x00000068
+#define PROP_description 0x00b2ccca
+#define PROP_template 0x00b2cccb
+#define PROP_parent 0x00b2cccb
+#define PROP_cameraZoomScale 0x00c7c4f8
+#define PROP_cameraRotateScale 0x00c7c4f9
+#define PROP_cameraTranslateScale 0x00c7c4fa
+#define PROP_cameraInitialTarget 0x00c7c4fa
+#define PROP_cameraInitialZoom 0x00c7c4fb
+#define PROP_cameraInitialPitch 0x00c7c4fc
+#define PROP_cameraInitialHeading 0x00c7c4fd
+#define PROP_ModelToLoad 0x00e5de84
+#define PROP_MVHandleSize 0x00e5de85
+#define PROP_cameraType 0x00ed3928
+#define PROP_cameraName 0x00ed3929
+#define PROP_cameraBackgroundColor 0x00ed392a
+#define PROP_defaultMinChange 0x00f75fb6
+#define PROP_defaultRate 0x00f75fb7
+#define PROP_modelBoundingRadius 0x00f9efb9
+#define PROP_modelBoundingBox 0x00f9efba
+#define PROP_modelMeshLOD0 0x00f9efbb
+#define PROP_modelMeshLOD1 0x00f9efbc
+#define PROP_modelMeshLOD2 0x00f9efbd
+#define PROP_modelMeshLOD3 0x00f9efbe
+#define PROP_modelMeshLowRes 0x00f9efbf
+#define PROP_modelMeshHull 0x00f9efc0
+#define PROP_modelMeshLODHi 0x00f9efc1
+#define PROP_modelOffset 0x00fba610
+#define PROP_modelScale 0x00fba611
+#define PROP_modelColor 0x00fba612
+#define PROP_modelRotation 0x00fba613
+#define PROP_modelZCorpMinScale 0x00fba614
+#define PROP_cameraDistances 0x00fc5228
+#define PROP_cameraFOVs 0x00fc6857
+#define PROP_cameraNearClips 0x00fc7047
+#define PROP_cameraFarClips 0x00fc704c
+#define PROP_cameraPitches 0x00fc71fc
+#define PROP_cameraMinPitches 0x00fc71fc
+#define PROP_cameraMaxPitches 0x00fc7205
+#define PROP_cameraOrientations 0x00fc78e7
+#define PROP_cameraMinZoomDistance 0x00fe23b2
+#define PROP_cameraMaxZoomDistance 0x00fe2437
+#define PROP_cameraMinPitch 0x00fe243b
+#define PROP_cameraMaxPitch 0x00fe243f
+#define PROP_skylight 0x0100eab6
+#define PROP_skylightStrength 0x0100eab7
+#define PROP_lightSunDir 0x0100eab8
+#define PROP_lightSunColor 0x0100eab9
+#define PROP_lightSunStrength 0x0100eaba
+#define PROP_lightSkyDir 0x0100eabb
+#define PROP_lightSkyColor 0x0100eabc
+#define PROP_lightSkyStrength 0x0100eabd
+#define PROP_lightFill1Dir 0x0100eabe
+#define PROP_lightFill1Color 0x0100eabf
+#define PROP_lightFill1Strength 0x0100eac0
+#define PROP_lightFill2Dir 0x0100eac1
+#define PROP_lightFill2Color 0x0100eac2
+#define PROP_lightFill2Strength 0x0100eac3
+#define PROP_exposure 0x0100eac4
+#define PROP_shCoeffs 0x0100eac5
+#define PROP_cameraSpaceLighting 0x0100eac6
+#define PROP_pointLightPos 0x0100eac7
+#define PROP_pointLightColor 0x0100eac8
+#define PROP_pointLightStrength 0x0100eac9
+#define PROP_pointLightRadius 0x0100eaca
+#define PROP_envHemiMap 0x0100eacb
+#define PROP_atmosphere 0x0100eacd
+#define PROP_diffBounce 0x0100eace
+#define PROP_specBounce 0x0100eacf
+#define PROP_cameraNearClip 0x01102b20
+#define PROP_cameraFarClip 0x01102b2f
+#define PROP_cameraExponential 0x015e0f54
+#define PROP_cameraWheelZoomScale 0x015e688f
+#define PROP_cameraExpPanScale 0x015e6baa
+#define PROP_cameraPanSubjectPos 0x015e84cd
+#define PROP_paramOffsets 0x02280abf
+#define PROP_paramNames 0x02280ac8
+#define PROP_cameraPitchScale 0x02438a8b
+#define PROP_planetAtmosphere 0x02478ed7
+#define PROP_planetBounceDiff 0x02478eda
+#define PROP_planetBounceSpec 0x02478edb
+#define PROP_planetSunBoost 0x02478edc
+#define PROP_planetTransitionBoost 0x02478edd
+#define PROP_planetNightBoost 0x02478ede
+#define PROP_planetDayStart 0x02478edf
+#define PROP_planetDayRange 0x02478ee0
+#define PROP_planetNightStart 0x02478ee1
+#define PROP_planetNightRange 0x02478ee2
+#define PROP_planetSaturation 0x02478ee3
+#define PROP_planetFogStrength 0x02478ee4
+#define PROP_UILocalizedResourceGroups_TypeID_CSS 0x0248f226
+#define PROP_horizonCullFactor 0x026b7d69
+#define PROP_AmbOccAOMul 0x026cabbf
+#define PROP_AmbOccAOBias 0x026dc91e
+#define PROP_UILocalizedResourceGroups_TypeID_TTF 0x027c5cef
+#define PROP_AmbOccBlurAmount 0x027c7387
+#define PROP_shadowCameraRange 0x027f36b9
+#define PROP_shadowScaleCurve 0x027f36ba
+#define PROP_shadowStrengthCurve 0x027f36bb
+#define PROP_tutorial_MSTutorialDLC_Nissan_Leaf 0x0292ec21
+#define PROP_modelEffect 0x02a907b5
+#define PROP_modelEffects 0x02a907b5
+#define PROP_modelEffectTransforms 0x02a907b6
+#define PROP_modelEffectSeed 0x02a907b7
+#define PROP_modelEffectRange 0x02a907b8
+#define PROP_modelEffectWorld 0x02a907b9
+#define PROP_modelEffectWorlds 0x02a907b9
+#define PROP_modelEffectsSoftStop 0x02a907ba
+#define PROP_modelLODDistances 0x02e33a81
+#define PROP_modelLODFactor0 0x02e765cf
+#define PROP_modelLODFactor1 0x02e765d0
+#define PROP_modelLODFactor2 0x02e765d1
+#define PROP_modelLODFactor3 0x02e765d2
+#define PROP_cameraMaterialLODs 0x030bc65a
+#define PROP_modelDefaultBoundingBox 0x031d2791
+#define PROP_modelDefaultBoundingRadius 0x031d2792
+#define PROP_ExtensionMap 0x04334f33
+#define PROP_DefaultGroup 0x04334f34
+#define PROP_modelName 0x043afa7e
+#define PROP_UILocalizedResourceGroups_TypeID_OTF 0x043b1ec5
+#define PROP_cameraInitialFOV 0x044c6220
+#define PROP_modelLODFlags0 0x0452027c
+#define PROP_modelLODFlags1 0x0452027d
+#define PROP_modelLODFlags2 0x0452027e
+#define PROP_modelLODFlags3 0x0452027f
+#define PROP_OptionDefaultsSet 0x0461709d
+#define PROP_OptionShadows 0x0461709e
+#define PROP_OptionTextureDetail 0x0461709f
+#define PROP_OptionEffects 0x046170a0
+#define PROP_OptionScreenSize 0x046170a1
+#define PROP_OptionFullScreen 0x046170a2
+#define PROP_OptionDiskCacheSize 0x046170a4
+#define PROP_OptionFitToScreen 0x046170a5
+#define PROP_OptionLighting 0x046170a6
+#define PROP_creditsNames 0x0463d294
+#define PROP_movieRes 0x046425b0
+#define PROP_photoRes 0x046425ce
+#define PROP_OptionPhotoRes 0x0473b8cb
+#define PROP_OptionVideoRes 0x0473b8cc
+#define PROP_OptionVersion 0x04754439
+#define PROP_envCubeMap 0x0477d61d
+#define PROP_modelPreloads 0x049b48ee
+#define PROP_lightingCel 0x049b94d4
+#define PROP_planetCelRange 0x049b94d5
+#define PROP_lightLargeModelRadius 0x049b94d6
+#define PROP_modelLightStrength 0x049fc837
+#define PROP_modelLightStrengths 0x049fc837
+#define PROP_modelLightColor 0x049fc838
+#define PROP_modelLightColour 0x049fc838
+#define PROP_modelLightColors 0x049fc838
+#define PROP_modelLightColours 0x049fc838
+#define PROP_modelLightSize 0x049fc839
+#define PROP_modelLightSizes 0x049fc839
+#define PROP_modelLightOffset 0x049fc83a
+#define PROP_modelLightOffsets 0x049fc83a
+#define PROP_modelSound 0x04a5b8d2
+#define PROP_decalLightEnabled 0x04adacd8
+#define PROP_decalLightStrength 0x04adacd9
+#define PROP_decalLightSize 0x04adacda
+#define PROP_highlightCurve 0x04c08536
+#define PROP_highlightLife 0x04c08537
+#define PROP_highlightColors 0x04c08538
+#define PROP_modelBakeTextureSize 0x04c6ba29
+#define PROP_modelBakeQuality 0x04c6ba3c
+#define PROP_AmbOccViewWindow 0x04ee8a87
+#define PROP_AmbOccSamplesType 0x04efaf18
+#define PROP_AmbOccSamplesZOffset 0x04efbdc8
+#define PROP_AmbOccSamplesInvert 0x04efd359
+#define PROP_dialogButton0 0x05107b17
+#define PROP_dialogButton1 0x05107b18
+#define PROP_dialogButton2 0x05107b19
+#define PROP_dialogButton3 0x05107b1a
+#define PROP_dialogOKButton 0x05108509
+#define PROP_dialogSelectedButton 0x0510a385
+#define PROP_modelAmbientOcclusion 0x0521fc0e
+#define PROP_modelBakeTextureDXT 0x052f7b17
+#define PROP_dialogEscButton 0x055a7c84
+#define PROP_dialogEnterButton 0x055a7c85
+#define PROP_shAreaLights 0x0566cae9
+#define PROP_shHemiLight 0x0566caea
+#define PROP_shAreaLightsScale 0x05678419
+#define PROP_shAreaLightsZRM 0x0567841a
+#define PROP_shCoeffsScale 0x056784b9
+#define PROP_shCoeffsZRM 0x056784ba
+#define PROP_envHemiMapScale 0x056784c9
+#define PROP_envHemiMapZRM 0x056784ca
+#define PROP_envCubeMapScale 0x056784d9
+#define PROP_envCubeMapZRM 0x056784da
+#define PROP_atmosphereScale 0x056784e9
+#define PROP_atmosphereZRM 0x056784ea
+#define PROP_shHemiLightScale 0x056784f9
+#define PROP_shHemiLightZRM 0x056784fa
+#define PROP_shadowTargetSnap 0x05879278
+#define PROP_shadowDirSnap 0x05879279
+#define PROP_shadowDirLerp 0x0587927a
+#define PROP_shadowScaleSnap 0x0587927b
+#define PROP_AmbOccNumSamples 0x05b99de4
+#define PROP_modelAmbOccStreamMesh 0x05b9a1ec
+#define PROP_modelAmbOccTuningFile 0x05b9a4fb
+#define PROP_OptionGameQuality 0x05c9482d
+#define PROP_NumFramesToBuffer 0x05c97448
+#define PROP_shadowCasterDistance 0x05d1b951
+#define PROP_shadowDepthRange 0x05d1b952
+#define PROP_OptionListTarget 0x05daaffe
+#define PROP_OptionIDs 0x05daafff
+#define PROP_OptionStartSettings 0x05dab000
+#define PROP_OptionEndSettings 0x05dab001
+#define PROP_AlwaysFullscreen 0x05dd4647
+#define PROP_modelMeshAnimSharing 0x060cbbef
+#define PROP_shadowNestFactor 0x06148bad
+#define PROP_shadowNestScaleCurve 0x0614a8f1
+#define PROP_dialogLayout 0x061594ab
+#define PROP_dialogDisableByOptions 0x0615a51a
+#define PROP_MacSpecificText 0x061b67b6
+#define PROP_modelQuantizeScales 0x061b99cd
+#define PROP_modelQuantizeTypeTags 0x061b99ce
+#define PROP_modelQuantizeBoneDir 0x061b99cf
+#define PROP_shadowHorizonFade 0x0625e847
+#define PROP_Support51Audio 0x063ab656
+#define PROP_planetAtmosphereUpdateTheta 0x064dab03
+#define PROP_modelBakeMeshBudget 0x067b804d
+#define PROP_modelBakeTextureDilate 0x0680a2b1
+#define PROP_shadowNightLightStart 0x0681a110
+#define PROP_shadowNestCameraRange 0x068ce755
+#define PROP_shadowAwayBias 0x0692e9aa
+#define PROP_planetAtmosphereOnly 0x0696cb45
+#define PROP_packageTitle 0x06ef59e4
+#define PROP_packagePriority 0x06ef59e5
+#define PROP_packageRequirements 0x06ef59e6
+#define PROP_packageID 0x06ef59e7
+#define PROP_packageBlessCheck 0x06ef59e8
+#define PROP_packageProductKey 0x06ef59e9
+#define PROP_packageRegistryKey 0x06ef59ea
+#define PROP_packageEntitleCheck 0x06ef59eb
+#define PROP_packageSteamAppID 0x07634d70
+#define PROP_shadowDirection 0x08240c5e
+#define PROP_cameraPlanarMovementRate 0x08e452f0
+#define PROP_cameraHeadingRotationRate 0x08e452f1
+#define PROP_cameraPitchRotationRate 0x08e452f2
+#define PROP_modelDecimationFactor0 0x09f18abe
+#define PROP_modelDecimationFactor1 0x09f18abf
+#define PROP_modelDecimationFactor2 0x09f18ac0
+#define PROP_modelDecimationFactor3 0x09f18ac1
+#define PROP_AudioMasterVolume 0x0aaf2940
+#define PROP_AudioAmbienceVolume 0x0aaf2941
+#define PROP_AudioMusicVolume 0x0aaf2942
+#define PROP_AudioSFXVolume 0x0aaf2943
+#define PROP_AudioUIVolume 0x0aaf2944
+#define PROP_AudioVOXVolume 0x0aaf2945
+#define PROP_AudioMuteAll 0x0aaf2950
+#define PROP_AudioSpeakerMode 0x0aaf2951
+#define PROP_cameraStartingDistance 0x0abd89fd
+#define PROP_UpdateChannel 0x0c357b70
+#define PROP_tutorial_MSTutorialDLC_PartnerMetro 0x0c541183
+#define PROP_OptionDisasterSlowdown 0x0d9a6060
+#define PROP_OptionPeopleQuality 0x0e619e57
+#define PROP_OptionSignQuality 0x0e619e58
+#define PROP_OptionUIZoomLevel 0x0e7422ce
+#define PROP_OptionGamma 0x0e7bf0d5
+#define PROP_tutorial_MSTutorialRegionMassTranist 0x0e881409
+#define PROP_OptionDisplayPathGuides 0x0e9513b4
+#define PROP_OptionCityImpostorQuality 0x0ec4a693
+#define PROP_OptionDisplayCityBoundary 0x0ed71bca
+#define PROP_OptionGeometryDetail 0x0ee02eba
+#define PROP_OptionAnimationDetail 0x0ee6a981
+#define PROP_OptionMovieRecordNoUI 0x0ee6dd0a
+#define PROP_OptionFXAA 0x0ee9a303
+#define PROP_OptionNoWindowBorders 0x0eeb4268
+#define PROP_OptionDOFStrength 0x0eebfe4b
+#define PROP_OptionFarCamera 0x0ef18906
+#define PROP_OptionPictureFilter 0x0efe44d8
+#define PROP_OptionEdgeScroll 0x0f11225d
+#define PROP_OptionFramerateCap 0x0f1e2951
+#define PROP_OptionHideSpeechBubbles 0x0f1f7006
+#define PROP_OptionHideThoughtBubbles 0x0f1f7017
+#define PROP_OptionHideVehicleAvatars 0x0f236dab
+#define PROP_OptionVsync 0x0f2b34d1
+#define PROP_IsIntelIntegratedGPU 0x0f30a0fa
+#define PROP_scWorldGame 0x0f362827
+#define PROP_scWorldRest 0x0f362828
+#define PROP_scWorldSocket 0x0f362829
+#define PROP_scWorldTelem 0x0f362830
+#define PROP_scWorldId 0x0f362831
+#define PROP_scWorldNameId 0x0f362832
+#define PROP_scWorldServiceNews 0x0f362833
+#define PROP_scWorldConnect 0x0f362834
+#define PROP_scWorldSub 0x0f362835
+#define PROP_OptionCameraGestureControl 0x0ffe72cc
+#define PROP_OptionMotionBlur 0x108f3b4c
+#define PROP_scOfflinePref 0x10a469a8
+#define PROP_tutorial_MSTutorialDLC_PartnerMicroMania 0x1193d5a2
+#define PROP_scInfoDisplayCount 0x1285b385
+#define PROP_tutorial_MSCivicTutorialGamblingIncProfitTransit 0x13d66f4c
+#define PROP_tutorial_MSCivicTutorialGamblingPassengerTrains 0x1750b8d0
+#define PROP_tutorial_MSCivicTutorialGamblingIncreasingProfit 0x197d1bac
+#define PROP_ShaderPath 0x1a34e253
+#define PROP_tutorial_MSTutorialDLC_HeroesAndVillains 0x1b207885
+#define PROP_WebkitEnableEnableJavaScriptDebugOutput 0x283d4540
+#define PROP_tutorial_MSCivicTutorialGamblingGamingDiv 0x2929a109
+#define PROP_tutorial_MSTutorialGiftingCoal 0x2ac0c32f
+#define PROP_tutorial_MSTutorialMiniGreatWorks 0x2ce67c26
+#define PROP_WebkitEnableImageCacheCompression 0x2e3dc7a1
+#define PROP_tutorial_MSTutorialDLC_PartnerPlay 0x2f1f7f46
+#define PROP_tutorial_MSTutorialDLC_EP1Drones 0x2fbed121
+#define PROP_OptionEnableAutosave 0x34862ea5
+#define PROP_tutorial_MSTutorialLandValue 0x36885f02
+#define PROP_perfColors 0x372f49bc
+#define PROP_tutorial_MSTutorialDLC_Crest 0x382e577b
+#define PROP_tutorial_MSTutorialSharingHealthServices 0x38db701e
+#define PROP_tutorial_MSTutorialCoalMinePlacement 0x390b3195
+#define PROP_tutorial_MSTutorialRoadUpgrades 0x3fd229c1
+#define PROP_tutorial_MSTutorialDLC_Airships 0x40f12c4b
+#define PROP_dialogText 0x4629edb4
+#define PROP_tutorial_MSTutorialClaimCity 0x4b4a53e5
+#define PROP_tutorial_MSTutorialSharingFireServices 0x4f1afd14
+#define PROP_tutorial_MSTutorialOilWellPlacement 0x510d7cc9
+#define PROP_tutorial_MSTutorialDLC_Worship 0x51b5a908
+#define PROP_tutorial_MSTutorialGiftingSimoleons 0x53f8821f
+#define PROP_tutorial_MSTutorialDLC_Berlin 0x5485caea
+#define PROP_tutorial_MSTutorialDLC_3CitySets 0x57ea2e73
+#define PROP_tutorial_MSTutorialTradeDepot 0x59df960c
+#define PROP_tutorial_MSTutorialDLC_PartnerTelia 0x5b0e8005
+#define PROP_WebkitCookieDiskSizeKilobytes 0x5de83b3f
+#define PROP_tutorial_MSTutorialMyFirstCity 0x631ef4f1
+#define PROP_tutorial_MSTutorialTradingSims 0x66ece90f
+#define PROP_tutorial_MSTutorialTradingSewage 0x687a9b5b
+#define PROP_tutorial_MSTutorialSharingGarbageServices 0x69c90ad5
+#define PROP_tutorial_MSTutorialTradingWater 0x6a334aa8
+#define PROP_tutorial_MSCivicTutorialGamblingLodgingDiv 0x6aa86d92
+#define PROP_tutorial_MSTutorialDLC_EP1MegaTower 0x6b331995
+#define PROP_dialogTitle 0x6b8241c9
+#define PROP_cameraInitialOffsetX 0x6fda2e1c
+#define PROP_tutorial_MSTutorialDLC_Progressive 0x70268737
+#define PROP_OptionGameCamera 0x705ee75d
+#define PROP_scOfflineLastPlayedBoxId 0x74402b5b
+#define PROP_tutorial_MSTutorialDLC_EP1Radiation 0x775d6ac5
+#define PROP_WebkitCookieDirectory 0x77bd4c46
+#define PROP_OptionAudioPerformance 0x7d8ed666
+#define PROP_tutorial_MSTutorialDLC_LaunchMemorialPark 0x7e62b181
+#define PROP_WebkitJavascriptStackSizeKilobytes 0x7f59bfc3
+#define PROP_tutorial_MSTutorialDLC_London 0x7fd4efcc
+#define PROP_tutorial_MSCivicTutorialGamblingHall 0x81caa3d6
+#define PROP_tutorial_MSTutorialHappiness 0x844ccdc3
+#define PROP_tutorial_MSTutorialSharingPoliceServices 0x85d3dd2e
+#define PROP_WebkitThrottleMouseMove 0x8786ba7f
+#define PROP_tutorial_GettingStartedScenario 0x8a7caabb
+#define PROP_cameraInitialOffsetY 0x8fda2e23
+#define PROP_tutorial_MSTutorialDLC_EP1CitiesOfTomorrow 0x94b585e7
+#define PROP_WebkitCookieMaxCount 0x9517e90e
+#define PROP_WebkitDirtyRectangleUpdates 0x96fd13ee
+#define PROP_OptionCameraPanMode 0xa0bc0ef1
+#define PROP_dropShadowQualityImage 0xa5bbb508
+#define PROP_WebkitDiskCacheDirectory 0xa5fe6feb
+#define PROP_perfLimits 0xa79e5398
+#define PROP_tutorial_MSTutorialDLC_PartnerMediaMarkt 0xab5d9c79
+#define PROP_WebkitDiskCacheSizeMegabytes 0xac114d6c
+#define PROP_tutorial_MSTutorialDLC_EP1OmegaCo 0xbd63e8ef
+#define PROP_tutorial_MSTutorialTradePort 0xbf455a17
+#define PROP_tutorial_MSTutorialDLC_AmusementParkMiniTutorial 0xc2eaba92
+#define PROP_tutorial_MSCivicTutorialGamblingAirport 0xc4bb2e00
+#define PROP_WebkitUserAgent 0xcb53e119
+#define PROP_tutorial_MSCivicTutorialGamblingEntDiv 0xcc23a94f
+#define PROP_perfPositions 0xcd5e2038
+#define PROP_OptionDisableOfflineTelem 0xd06d26d1
+#define PROP_tutorial_MSTutorialGiftingOil 0xd0725daa
+#define PROP_modelSprite0 0xd124fce4
+#define PROP_modelSprite1 0xd124fce7
+#define PROP_WebkitCookieMaxIndividualSizeBytes 0xd3bb1b04
+#define PROP_WebkitDrawIntermediatePages 0xd4baa2fe
+#define PROP_tutorial_MSTutorialDensity 0xd4c214fc
+#define PROP_perfLabels 0xd5dceff5
+#define PROP_tutorial_MSTutorialDLC_RomanLuckCasino 0xd6933d37
+#define PROP_WebkitEnableGammaCorrection 0xd8d42c59
+#define PROP_WebkitRamCacheSizeKilobytes 0xd9ddcc52
+#define PROP_tutorial_MSTutorialBudgetUI 0xda7639f9
+#define PROP_dialogTimeout 0xdb8b6bf2
+#define PROP_EffectsInstancing 0xdcd55da1
+#define PROP_tutorial_MSTutorialDLC_EP1EntitledNeighbor 0xde050ce9
+#define PROP_dropShadowQualityText 0xe30a842c
+#define PROP_OptionShowTutorials 0xe62031ea
+#define PROP_tutorial_MSTutorialTradingPower 0xe6eee50a
+#define PROP_WebkitRamCachePageCount 0xe7798f2d
+#define PROP_tutorial_MSTutorialDLC_RedCross 0xed8a8941
+#define PROP_tutorial_MSTutorialDLC_Paris 0xef26b5eb
+#define PROP_tutorial_MSTutorialDLC_EP1Academy 0xef919d10
+#define PROP_OptionDisableDisasters 0xf372f846
+#define PROP_tutorial_MSTutorialDLC_AmusementParks 0xf919f728
+
+#define BUILTIN_PROP_COUNT 389
+#define BUILTIN_TYPE_COUNT 31
+
+// Sorted by id.
+extern const unsigned long builtinPropIds[BUILTIN_PROP_COUNT];
+extern const char *const builtinPropNames[BUILTIN_PROP_COUNT];
+extern const unsigned int builtinTypeIds[BUILTIN_TYPE_COUNT];
+extern const char *const builtinTypeNames[BUILTIN_TYPE_COUNT];
+
+#endif
@@ -2,6 +2,7 @@
 #define _RAST_
 
 #include <cpl_raylib.h>
+#include "arena.h"
 
 typedef struct RastData {
     bool corrupted;
@@ -9,6 +10,8 @@ typedef struct RastData {
 } RastData;
 
 RastData LoadRastData(unsigned char *data, int dataSize);
+// The pixels come from arena and must not be passed to UnloadImage.
+RastData LoadRastDataInArena(unsigned char *data, int dataSize, Arena *arena);
 
 #endif
 
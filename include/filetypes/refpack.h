@@ -0,0 +1,34 @@
+#ifndef _REFPACK_
+#define _REFPACK_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+// Reads the decompressed size from a RefPack header. Returns false if the
+// header is truncated or the signature is wrong.
+bool refpack_header(const uint8_t *in, size_t in_size, size_t *header_size, size_t *decompressed_size);
+
+// Decompresses a RefPack stream of in_size bytes into out, writing at most
+// out_capacity bytes. Returns the number of bytes written, or -1 if the stream
+// is malformed: truncated, referencing data before the start of the output,
+// or larger than out_capacity.
+ptrdiff_t refpack_decompress(const uint8_t *in, size_t in_size, uint8_t *out, size_t out_capacity);
+
+#define REFPACK_FAST     1 // Short hash chains, greedy parsing.
+#define REFPACK_BALANCED 2 // Longer chains with one step of lazy matching.
+#define REFPACK_MAX      3 // Searches the whole window for the longest match.
+
+// Largest output refpack_compress can produce for in_size bytes of input.
+size_t refpack_compress_bound(size_t in_size);
+
+// Compresses in_size bytes into out at one of the REFPACK_* levels. Returns the
+// compressed size, or -1 if the result does not fit in out_capacity; passing a
+// capacity below in_size stops early when compressing would not pay off.
+ptrdiff_t refpack_compress(const uint8_t *in, size_t in_size, uint8_t *out, size_t out_capacity, int level);
+
+// The original byte-at-a-time decoder, kept as a reference for tests and
+// benchmarks. Never use it on data that has not been validated.
+size_t refpack_decompress_unsafe(const uint8_t *indata, size_t *bytes_read_out, uint8_t *outdata);
+
+#endif
@@ -1,6 +1,32 @@
 #ifndef _HASH_
 #define _HASH_
 
-unsigned long TheHash(char *strptr);
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Spore's name hash: 32-bit FNV of the ASCII-lowercased name.
+unsigned long TheHash(const char *str);
+// Same, for names that are not null-terminated.
+unsigned long TheHashLength(const char *str, size_t length);
+// Hashes count names into hashes. lengths may be NULL for null-terminated names.
+void TheHashBatch(const char *const *strs, const size_t *lengths, int count, uint32_t *hashes);
+
+// 64-bit fingerprint of a buffer (xxHash64, seed 0). Fast, not cryptographic.
+uint64_t HashData64(const void *data, size_t size);
+
+#ifdef __cplusplus
+}
+
+// TheHash at compile time, for case labels and constants. C code uses the
+// PROP_* ids from filetypes/propnames.h instead.
+constexpr uint32_t TheHashConst(const char *str, uint32_t hash = 0x811C9DC5)
+{
+    return *str ? TheHashConst(str + 1, hash * 0x1000193 ^ (uint32_t)(int)(char)(*str >= 'A' && *str <= 'Z' ? *str + 32 : *str)) : hash;
+}
+#endif
 
 #endif
@@ -0,0 +1,20 @@
+#ifndef _MAPFILE_
+#define _MAPFILE_
+
+#include <stdio.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+// A read-only view of a whole file. Pages are mapped copy-on-write, so a parser
+// that scribbles on its input never reaches the file on disk.
+typedef struct MappedFile {
+    unsigned char *data;
+    size_t size;
+} MappedFile;
+
+MappedFile MapFile(FILE *f);
+MappedFile MapFileFromPath(const char *filename);
+bool IsFileMapped(MappedFile map);
+void UnmapFile(MappedFile map);
+
+#endif
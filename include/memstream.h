@@ -2,13 +2,35 @@
 #define _MEMSTREAM_H_
 
 #include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <cpl_endian.h>
+#include "arena.h"
 
+// A zeroed MemStream is an empty heap stream; release it with memstream_free.
+// Write streams keep capacity apart from size and double it when full, so
+// appending is amortized O(1) per byte.
 typedef struct MemStream {
     void *buf;
     int size;
     void *cur;
+
+    int capacity;   // Bytes allocated at buf.
+    Arena *arena;   // Grows from here instead of the heap when set.
+    bool fixed;     // buf belongs to the caller and never grows.
+    bool error;     // Sticky: set once a read or a fixed write went past the end.
 } MemStream;
 
+MemStream memstream_create(int capacity);
+// Old buffers stay in the arena until it is reset.
+MemStream memstream_create_in_arena(Arena *arena, int capacity);
+// Writes past capacity are dropped and set error.
+MemStream memstream_create_fixed(void *buf, int capacity);
+// Makes room for capacity bytes in total. Returns false if a fixed stream cannot.
+bool memstream_reserve(MemStream *stream, int capacity);
+// Only frees heap buffers. Leaves an empty stream on the same arena.
+void memstream_free(MemStream *stream);
+
 void memstream_write(MemStream *stream, void *buf, int size);
 void memstream_writestream(MemStream *dest, MemStream *src);
 void memstream_write32(MemStream *dest, uint32_t n);
@@ -16,10 +38,79 @@ void memstream_write16(MemStream *dest, uint16_t n);
 void memstream_write8(MemStream *dest, uint8_t n);
 
 MemStream memstream_read_create(unsigned char *data, int dataSize);
+// Short reads set error and zero the rest of buf.
 int memstream_read(MemStream *stream, void *buf, int size);
 uint32_t memstream_read32(MemStream *stream);
 uint16_t memstream_read16(MemStream *stream);
 uint8_t  memstream_read8(MemStream *stream);
 
-#endif
+// Moves to offset from the start. Past the end sets error.
+bool memstream_seek(MemStream *stream, int offset);
+// A reader over size bytes at offset from the start of stream. Out of range
+// sets error on both and returns an empty reader.
+MemStream memstream_subspan(MemStream *stream, int offset, int size);
+
+// Bounds-checked readers for parsers. Running past the end moves the cursor
+// to the end, sets error and yields zeros, so a whole record can be read
+// before error is checked once. Being inline, checks on a local stream
+// usually fold together in loops.
+
+static inline int memstream_tell(const MemStream *stream)
+{
+    return (int)((unsigned char *)stream->cur - (unsigned char *)stream->buf);
+}
+
+static inline int memstream_remaining(const MemStream *stream)
+{
+    return stream->size - memstream_tell(stream);
+}
+
+// The next size bytes without consuming them, or NULL if there are fewer.
+static inline const unsigned char *memstream_peek(const MemStream *stream, int size)
+{
+    return (unsigned int)size <= (unsigned int)memstream_remaining(stream) ? stream->cur : NULL;
+}
+
+// Consumes size bytes and returns where they start, or NULL past the end.
+static inline const unsigned char *memstream_take(MemStream *stream, int size)
+{
+    const unsigned char *p = stream->cur;
 
+    if (__builtin_expect((unsigned int)size > (unsigned int)memstream_remaining(stream), 0))
+    {
+        stream->cur = (unsigned char *)stream->buf + stream->size;
+        stream->error = true;
+        return NULL;
+    }
+
+    stream->cur = (unsigned char *)stream->cur + size;
+    return p;
+}
+
+static inline bool memstream_skip(MemStream *stream, int size)
+{
+    return memstream_take(stream, size) != NULL;
+}
+
+#define memstream_read_endian_(name, type, bits, conv) \
+static inline type memstream_read_##name(MemStream *stream) \
+{ \
+    const unsigned char *p = memstream_take(stream, bits/8); \
+    uint##bits##_t val = 0; \
+    if (p) memcpy(&val, p, bits/8); \
+    val = conv(val); \
+    type ret; \
+    memcpy(&ret, &val, sizeof(ret)); \
+    return ret; \
+}
+
+memstream_read_endian_(be16, uint16_t, 16, be16toh)
+memstream_read_endian_(le16, uint16_t, 16, le16toh)
+memstream_read_endian_(be32, uint32_t, 32, be32toh)
+memstream_read_endian_(le32, uint32_t, 32, le32toh)
+memstream_read_endian_(f32be, float, 32, be32toh)
+memstream_read_endian_(f32le, float, 32, le32toh)
+
+#undef memstream_read_endian_
+
+#endif
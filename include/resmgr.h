@@ -0,0 +1,63 @@
+#ifndef _RESMGR_
+#define _RESMGR_
+
+#include "filetypes/package.h"
+
+// Packages stacked as layers over one global (type, group, instance) index.
+// A key resolves to the topmost layer that has it, and within a layer to its
+// last entry. Layers are referenced, never copied, so adding one only costs
+// its own entries and removing one only revisits the keys it provided.
+
+typedef struct ResourceLayer {
+    Package pkg;
+    char *name;
+    bool active;
+} ResourceLayer;
+
+typedef struct ResourceSlot {
+    unsigned int type;
+    unsigned int group;
+    unsigned int instance;
+    int layer;              // RESOURCE_SLOT_EMPTY or RESOURCE_SLOT_DELETED when unused.
+    int entry;
+} ResourceSlot;
+
+#define RESOURCE_SLOT_EMPTY   -1
+#define RESOURCE_SLOT_DELETED -2
+
+typedef struct ResourceManager {
+    ResourceLayer *layers;  // In priority order; removed layers stay as inactive holes.
+    int layerCount;
+
+    ResourceSlot *slots;    // Open addressing table, always a power of two.
+    unsigned int slotCount;
+    unsigned int resourceCount; // Distinct keys currently resolvable.
+    unsigned int usedSlots;     // Live and deleted slots.
+
+    // Keys of the layers added by AddResolvedResourceLayers, sorted by TGI.
+    // Searched when slots has no entry; slots only holds layers added since.
+    const ResourceSlot *baseSlots;
+    unsigned int baseCount;
+    MappedFile baseMapping; // Holds baseSlots.
+} ResourceManager;
+
+// Takes ownership of pkg and puts it above every existing layer. Returns the
+// layer id used by RemoveResourceLayer.
+int AddResourceLayer(ResourceManager *mgr, Package pkg, const char *name);
+// Takes ownership of count packages and adds them to an empty manager as if
+// by AddResourceLayer in order, but with their keys already resolved: table
+// holds one slot per key, sorted by TGI, naming the winning layer (0 for
+// pkgs[0]) and entry. It is searched as is, and mapping, which holds it, is
+// unmapped with the manager. See LoadCachedResources in pkgcache.h.
+void AddResolvedResourceLayers(ResourceManager *mgr, const Package *pkgs, const char **names, int count,
+                               const ResourceSlot *table, unsigned int tableCount, MappedFile mapping);
+// Unloads the layer's package; keys it provided fall back to lower layers.
+void RemoveResourceLayer(ResourceManager *mgr, int layer);
+void UnloadResourceManager(ResourceManager *mgr);
+
+// Returns the winning entry's index stub, without decoding it, or NULL.
+PackageEntry *FindResource(const ResourceManager *mgr, unsigned int type, unsigned int group, unsigned int instance);
+// Like FindResource, but decodes the entry first; see GetPackageEntryData.
+PackageEntry *GetResourceData(const ResourceManager *mgr, unsigned int type, unsigned int group, unsigned int instance);
+
+#endif
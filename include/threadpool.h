@@ -1,10 +1,103 @@
 #ifndef _THREADPOOL_
 #define _THREADPOOL_
 
-void InitThreadpool(int nproc);
-void NewThreadpoolTask(void (*task)(void*), void *arg);
-void WaitForThreadpoolTasksDone(void);
-int GetThreadpoolTasksLeft(void);
-void CloseThreadpool(void);
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct Threadpool Threadpool;
+
+// TaskGroup.priority
+#define TASK_PRIORITY_NORMAL 0
+#define TASK_PRIORITY_HIGH   1 // Runs before any normal task that has not started yet.
+#define TASK_PRIORITY_IDLE   2 // Only runs when no other task is queued.
+
+// Tasks that are waited on and cancelled together. Must stay at the same
+// address until WaitForTaskGroup returns.
+typedef struct TaskGroup {
+    Threadpool *pool;           // NULL runs every task immediately on the caller.
+    struct TaskGroup *parent;   // Cancelling the parent also cancels this group.
+    int priority;               // TASK_PRIORITY_*, for every task of the group.
+    int pending;
+    bool cancelled;
+} TaskGroup;
+
+#define TASK_PENDING   0
+#define TASK_DONE      1
+#define TASK_CANCELLED 2 // The group was cancelled before the task started.
+
+// Result handle for a single task.
+typedef struct TaskFuture {
+    void *(*task)(void*);
+    void *arg;
+    void *result;
+    TaskGroup *group;
+    int state;
+} TaskFuture;
+
+// Shared by the tasks of NewTaskGroupRange. Must stay at the same address
+// until the group is done; next tells how far the range was claimed.
+typedef struct TaskRange {
+    void (*fn)(int begin, int end, void *ctx);
+    void *ctx;
+    int next;
+    int end;
+    int grain;
+    int divisor;
+} TaskRange;
+
+// Pass -1 for one thread per processor.
+Threadpool *LoadThreadpool(int nproc);
+void UnloadThreadpool(Threadpool *pool);
+
+// Process-wide pool, created on first use and kept until CloseSharedThreadpool.
+Threadpool *GetSharedThreadpool(void);
+void CloseSharedThreadpool(void);
+
+// The pool running the calling task, or the shared pool outside of tasks.
+Threadpool *GetCurrentThreadpool(void);
+
+// Called from inside a task, the new task goes to the calling worker's own
+// queue and may be stolen by idle workers.
+void NewThreadpoolTask(Threadpool *pool, void (*task)(void*), void *arg);
+void WaitForThreadpoolTasksDone(Threadpool *pool);
+int GetThreadpoolTasksLeft(Threadpool *pool);
+int GetThreadpoolThreadCount(Threadpool *pool);
+
+// A group created inside a task becomes a child of that task's group.
+TaskGroup NewTaskGroup(Threadpool *pool);
+void NewTaskGroupTask(TaskGroup *group, void (*task)(void*), void *arg);
+// Covers [begin, end) with one task per thread, submitted in one go. Each task
+// keeps claiming chunks of at least grain items, large at first and smaller
+// as the range runs out, and stops claiming once the group is cancelled.
+void NewTaskGroupRange(TaskGroup *group, TaskRange *range, int begin, int end, int grain, void (*fn)(int begin, int end, void *ctx), void *ctx);
+// Runs queued tasks of the group and of its child groups while it is busy, so
+// tasks can wait on their subtasks, and sleeps when there are none. Other
+// tasks are left alone. A task that submits to several groups should wait on
+// the last one first.
+void WaitForTaskGroup(TaskGroup *group);
+int GetTaskGroupTasksLeft(TaskGroup *group);
+
+// Tasks of a cancelled group that have not started are skipped. Running tasks
+// should poll IsCurrentTaskCancelled and return early.
+void CancelTaskGroup(TaskGroup *group);
+bool IsTaskGroupCancelled(TaskGroup *group);
+bool IsCurrentTaskCancelled(void);
+
+void NewTaskFuture(TaskGroup *group, TaskFuture *future, void *(*task)(void*), void *arg);
+// Returns the task's result, or NULL if it was cancelled. Helps like
+// WaitForTaskGroup, with the tasks of the future's group.
+void *WaitForTaskFuture(TaskFuture *future);
+bool IsTaskFutureDone(TaskFuture *future);
+
+// Calls fn on chunks of [begin, end) of at least grain items, spread over the
+// current pool, and returns once all of them are done.
+void ParallelFor(int begin, int end, int grain, void (*fn)(int begin, int end, void *ctx), void *ctx);
+
+// Like ParallelFor, but each chunk accumulates into its own copy of *result,
+// which must hold the identity of join. The partials are then joined into
+// *result in range order.
+void ParallelReduce(int begin, int end, int grain, void *result, size_t resultSize,
+                    void (*fn)(int begin, int end, void *ctx, void *partial),
+                    void (*join)(void *result, void *partial, void *ctx), void *ctx);
 
 #endif
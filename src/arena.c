@@ -0,0 +1,124 @@
+#include "arena.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define ARENA_ALIGN 16
+#define ALIGN_UP(x) (((x) + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1))
+
+typedef struct ArenaBlock {
+    struct ArenaBlock *next;
+    size_t size;
+    size_t used;
+} ArenaBlock;
+
+// Where a block's memory starts, past its header.
+#define BLOCK_DATA(block) ((unsigned char *)(block) + ALIGN_UP(sizeof(ArenaBlock)))
+
+static ArenaBlock *NewArenaBlock(Arena *arena, size_t size)
+{
+    ArenaBlock *block = malloc(ALIGN_UP(sizeof(ArenaBlock)) + size);
+
+    block->size = size;
+    block->used = 0;
+    arena->reserved += size;
+
+    return block;
+}
+
+void *ArenaAlloc(Arena *arena, size_t size)
+{
+    if (!arena) return malloc(size);
+
+    size_t blockSize = arena->blockSize ? arena->blockSize : ARENA_DEFAULT_BLOCK_SIZE;
+    ArenaBlock *head = arena->blocks;
+
+    size = ALIGN_UP(size);
+
+    if (head && head->used + size <= head->size)
+    {
+        void *ret = BLOCK_DATA(head) + head->used;
+        head->used += size;
+        return ret;
+    }
+
+    // Large allocations get a block of their own, kept behind the current
+    // block so its free space is still used.
+    if (size > blockSize / 2)
+    {
+        ArenaBlock *block = NewArenaBlock(arena, size);
+
+        block->used = size;
+        if (head)
+        {
+            block->next = head->next;
+            head->next = block;
+        }
+        else
+        {
+            block->next = NULL;
+            arena->blocks = block;
+        }
+
+        return BLOCK_DATA(block);
+    }
+
+    ArenaBlock *block = NewArenaBlock(arena, blockSize);
+
+    block->next = head;
+    block->used = size;
+    arena->blocks = block;
+
+    return BLOCK_DATA(block);
+}
+
+void *ArenaCalloc(Arena *arena, size_t count, size_t size)
+{
+    if (!arena) return calloc(count, size);
+
+    void *ret = ArenaAlloc(arena, count * size);
+    memset(ret, 0, count * size);
+
+    return ret;
+}
+
+void ResetArena(Arena *arena)
+{
+    size_t blockSize = arena->blockSize ? arena->blockSize : ARENA_DEFAULT_BLOCK_SIZE;
+    ArenaBlock *kept = NULL;
+
+    for (ArenaBlock *block = arena->blocks, *next; block; block = next)
+    {
+        next = block->next;
+
+        if (!kept && block->size == blockSize)
+        {
+            kept = block;
+            continue;
+        }
+
+        free(block);
+    }
+
+    arena->blocks = kept;
+    arena->reserved = 0;
+
+    if (kept)
+    {
+        kept->next = NULL;
+        kept->used = 0;
+        arena->reserved = kept->size;
+    }
+}
+
+void UnloadArena(Arena *arena)
+{
+    for (ArenaBlock *block = arena->blocks, *next; block; block = next)
+    {
+        next = block->next;
+        free(block);
+    }
+
+    arena->blocks = NULL;
+    arena->reserved = 0;
+}
@@ -0,0 +1,78 @@
+#include "filetypes/namedict.h"
+#include "filetypes/package.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Gathers names from packages, text files (MUiLE JSON, scripts), wordlists
+// and Properties.txt files into a name dictionary for the editor.
+//
+// Usage: build_namedict [-o names.dict] [-w wordlist]... [-p Properties.txt]... [file]...
+// Files ending in .package are streamed entry by entry; anything else is read as text.
+// The built-in Properties.txt names are always included.
+
+static bool HasExtension(const char *filename, const char *ext)
+{
+    size_t length = strlen(filename), extLength = strlen(ext);
+    return length >= extLength && !strcmp(filename + length - extLength, ext);
+}
+
+static bool AddFile(NameDictBuilder *builder, const char *filename)
+{
+    if (HasExtension(filename, ".package"))
+    {
+        FILE *f = fopen(filename, "rb");
+
+        if (!f)
+        {
+            perror(filename);
+            return false;
+        }
+
+        int entries = AddNamesFromPackageFile(builder, f);
+        fclose(f);
+
+        printf("%s: %d entries\n", filename, entries);
+        return true;
+    }
+
+    MappedFile map = MapFileFromPath(filename);
+
+    if (!IsFileMapped(map))
+    {
+        perror(filename);
+        return false;
+    }
+
+    AddNamesFromText(builder, (const char *)map.data, map.size);
+    UnmapFile(map);
+
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    const char *output = NAMEDICT_FILENAME;
+    NameDictBuilder *builder = CreateNameDictBuilder();
+    int failed = 0;
+
+    SetWriteCorruptedPackageEntries(false);
+    AddPropertyNames(builder, GetBuiltinPropertyNameList());
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (!strcmp(argv[i], "-o") && i + 1 < argc) output = argv[++i];
+        else if (!strcmp(argv[i], "-w") && i + 1 < argc) failed += !AddNameWordlist(builder, argv[++i]);
+        else if (!strcmp(argv[i], "-p") && i + 1 < argc) AddPropertyNames(builder, LoadPropertyNameList(argv[++i]));
+        else failed += !AddFile(builder, argv[i]);
+    }
+
+    NameDict dict = BuildNameDict(builder);
+    bool saved = SaveNameDict(dict, output);
+
+    if (saved) printf("%d names written to %s\n", GetNameDictCount(dict), output);
+
+    UnloadNameDict(dict);
+
+    return saved && !failed ? 0 : 1;
+}
@@ -1,6 +1,11 @@
 #include <raylib.h>
 #include "filetypes/package.h"
+#include "filetypes/pkgwrite.h"
+#include "filetypes/pkgsearch.h"
+#include "filetypes/entrycache.h"
+#include "filetypes/namedict.h"
 #include <raymath.h>
+#include <stdint.h>
 #include <threadpool.h>
 #include <cpl_pthread.h>
 #include <getopt.h>
@@ -16,6 +21,18 @@
 static Package loadedPkg = { 0 };
 static int selectedPkgEntry = -1;
 
+// Entries are decoded ahead of the user: visible rows first, the rest of the
+// package whenever the pool has nothing else to do and the cache has room.
+static TaskGroup visibleDecodeGroup;
+static TaskGroup idleDecodeGroup;
+static bool *decodeRequested;
+static int nextIdleDecode;
+
+// Decoded data kept for entries that are not on screen.
+#define EDITOR_CACHE_BUDGET (512 * 1024 * 1024)
+
+static int shownEntry = -1; // Pinned in the entry cache while selected.
+
 typedef struct {
     // Window management variables
     bool windowActive;
@@ -202,28 +219,8 @@ static bool DrawListRow(Rectangle bounds, ListRow row, bool selected, bool canSe
 
 static const char *PackageEntryTypeToString(unsigned int type)
 {
-    switch (type)
-    {
-        case PKGENTRY_PROP: return "PROP";
-        case PKGENTRY_SCPT: return "SCPT";
-        case PKGENTRY_RULE: return "RULE";
-        case PKGENTRY_JSON: return "JSON";
-        case PKGENTRY_RAST: return "RAST";
-        case PKGENTRY_TEXT: return "TEXT";
-        case PKGENTRY_PNG: return "PNG";
-        case PKGENTRY_JSN8: return "JSON8";
-        case PKGENTRY_BNK: return "BNK";
-        case PKGENTRY_CSS: return "CSS";
-        case PKGENTRY_RW4: return "RW4";
-        case PKGENTRY_GIF: return "GIF";
-        case PKGENTRY_MOV: return "MOV";
-        case PKGENTRY_EXIF: return "EXIF";
-        case PKGENTRY_SWB: return "SWB";
-        case PKGENTRY_HTML: return "HTML";
-        case PKGENTRY_ER2: return "ER2";
-        case PKGENTRY_TTF: return "TTF";
-        default: return "UNKN";
-    }
+    const char *name = GetPackageEntryTypeName(type);
+    return name ? name : "UNKN";
 }
 
 static const char *PropValToString(PropVariable var, int i)
@@ -312,13 +309,9 @@ static void DrawPackageEntry(PackageEntry entry, PropertyNameList nameList)
                 row.elementWidth = (float[3]){0.333, 0.333, 0.333};
                 row.elementText = (const char *[3]){TextFormat("%#X", var.identifier), TextFormat("%#X (%s)", var.type, PropVarTypeToString(var.type)), TextFormat("%#X", var.count)};
 
-                for (int j = 0; j < nameList.propCount; j++)
-                {
-                    if (var.identifier == nameList.propIds[j])
-                    {
-                        row.elementText[0] = TextFormat("%#X (%s)", var.identifier, nameList.propNames[j]);
-                    }
-                }
+                const char *name = FindPropertyName(nameList, var.identifier);
+                if (!name) name = LookupName(var.identifier);
+                if (name) row.elementText[0] = TextFormat("%#X (%s)", var.identifier, name);
 
                 bool shouldToggleSelect = DrawListRow((Rectangle){
                     GetScreenWidth()/2, RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT*(i+2)+propScroll.y,
@@ -464,15 +457,212 @@ static void DrawPackageEntry(PackageEntry entry, PropertyNameList nameList)
 typedef struct LoadPackageFileAsyncArgs {
     FILE *f;
     Package *pkg;
+    TaskGroup group;
     bool done;
 } LoadPackageFileAsyncArgs;
 
 static void *loadPackageFile_async(void *param)
 {
     LoadPackageFileAsyncArgs *args = param;
-    args->done = false;
-    *args->pkg = LoadPackageFile(args->f);
-    args->done = true;
+    *args->pkg = LoadPackageFileInGroup(args->f, PKGLOAD_LAZY, &args->group);
+    __atomic_store_n(&args->done, true, __ATOMIC_RELEASE);
+    return NULL;
+}
+
+// Loads a package while drawing progress. Dropping another package in the
+// meantime cancels this load and starts on the new one instead.
+static Package LoadDroppedPackage(const char *path)
+{
+    char nextPath[4096];
+    Package pkg = { 0 };
+
+    TextCopy(nextPath, path);
+
+    while (1)
+    {
+        FILE *f = fopen(nextPath, "rb");
+        if (!f)
+        {
+            perror(nextPath);
+            return (Package){ 0 };
+        }
+
+        LoadPackageFileAsyncArgs args = { .f = f, .pkg = &pkg, .group = NewTaskGroup(GetSharedThreadpool()) };
+        pthread_t thread;
+        pthread_create(&thread, NULL, loadPackageFile_async, &args);
+
+        while (!__atomic_load_n(&args.done, __ATOMIC_ACQUIRE))
+        {
+            if (IsFileDropped())
+            {
+                FilePathList droppedFiles = LoadDroppedFiles();
+
+                if (droppedFiles.count == 1 && IsFileExtension(droppedFiles.paths[0], ".package"))
+                {
+                    TextCopy(nextPath, droppedFiles.paths[0]);
+                    CancelTaskGroup(&args.group);
+                }
+
+                UnloadDroppedFiles(droppedFiles);
+            }
+
+            BeginDrawing();
+            ClearBackground(RAYWHITE);
+            DrawText(TextFormat("Loading... %d left", GetTaskGroupTasksLeft(&args.group)), GetScreenWidth() / 2 - MeasureText("Loading...", 20)/2, GetScreenHeight() / 2 - 10, 20, GRAY);
+            EndDrawing();
+        }
+
+        pthread_join(thread, NULL);
+        fclose(f);
+
+        if (!IsTaskGroupCancelled(&args.group)) return pkg;
+
+        UnloadPackageFile(pkg);
+    }
+}
+
+// Entries are decoded the first time they are shown, so their textures are uploaded then too.
+static PackageEntry *GetShownPackageEntry(int i)
+{
+    if (i != shownEntry)
+    {
+        if (shownEntry != -1) ReleasePackageEntryData(&loadedPkg.entries[shownEntry]);
+        AcquirePackageEntryData(loadedPkg, i);
+        shownEntry = i;
+    }
+
+    PackageEntry *entry = &loadedPkg.entries[i];
+
+    if (entry->corrupted) return entry;
+
+    switch (entry->type)
+    {
+        case PKGENTRY_RAST:
+        case PKGENTRY_PNG:
+        case PKGENTRY_GIF:
+        {
+            if (IsImageValid(entry->data.imgData.img) && !IsTextureValid(entry->data.imgData.tex))
+            {
+                entry->data.imgData.tex = LoadTextureFromImage(entry->data.imgData.img);
+            }
+        } break;
+        case PKGENTRY_RW4:
+        {
+            if (entry->data.rw4Data.type == RW4_TEXTURE && IsImageValid(entry->data.rw4Data.data.texData.img) && !IsTextureValid(entry->data.rw4Data.data.texData.tex))
+            {
+                entry->data.rw4Data.data.texData.tex = LoadTextureFromImage(entry->data.rw4Data.data.texData.img);
+            }
+        } break;
+        default: break;
+    }
+
+    return entry;
+}
+
+static void decodecycle(void *param)
+{
+    PrefetchPackageEntryData(loadedPkg, (int)(intptr_t)param);
+}
+
+// Decodes one entry and queues itself again, so visible rows can cut in
+// between entries. Stops once the cache is full.
+static void idledecodecycle(void *param)
+{
+    int i = __atomic_fetch_add(&nextIdleDecode, 1, __ATOMIC_RELAXED);
+
+    if (i >= (int)loadedPkg.entryCount) return;
+
+    if (PrefetchPackageEntryData(loadedPkg, i)) NewTaskGroupTask(&idleDecodeGroup, idledecodecycle, NULL);
+}
+
+static void StartDecodeGroups(void)
+{
+    Threadpool *pool = GetSharedThreadpool();
+
+    visibleDecodeGroup = NewTaskGroup(pool);
+    visibleDecodeGroup.priority = TASK_PRIORITY_HIGH;
+    idleDecodeGroup = NewTaskGroup(pool);
+    idleDecodeGroup.priority = TASK_PRIORITY_IDLE;
+
+    for (int i = 0; i < GetThreadpoolThreadCount(pool); i++)
+    {
+        NewTaskGroupTask(&idleDecodeGroup, idledecodecycle, NULL);
+    }
+}
+
+static void StartEntryDecoding(void)
+{
+    decodeRequested = calloc(loadedPkg.entryCount, sizeof(bool));
+    nextIdleDecode = 0;
+
+    StartDecodeGroups();
+}
+
+static void StopDecodeGroups(void)
+{
+    CancelTaskGroup(&visibleDecodeGroup);
+    CancelTaskGroup(&idleDecodeGroup);
+    WaitForTaskGroup(&visibleDecodeGroup);
+    WaitForTaskGroup(&idleDecodeGroup);
+}
+
+// Exporting reads entries from worker threads, so nothing may decode them
+// meanwhile. Unlike StopEntryDecoding, the cache keeps what it has.
+static void PauseEntryDecoding(void)
+{
+    if (decodeRequested) StopDecodeGroups();
+}
+
+static void ResumeEntryDecoding(void)
+{
+    if (!decodeRequested) return;
+
+    // Cancelled requests were never decoded.
+    memset(decodeRequested, 0, loadedPkg.entryCount * sizeof(bool));
+    StartDecodeGroups();
+}
+
+// Must be called before loadedPkg is replaced or unloaded.
+static void StopEntryDecoding(void)
+{
+    if (!decodeRequested) return;
+
+    StopDecodeGroups();
+
+    free(decodeRequested);
+    decodeRequested = NULL;
+
+    if (shownEntry != -1) ReleasePackageEntryData(&loadedPkg.entries[shownEntry]);
+    shownEntry = -1;
+    RemovePackageFromEntryCache(loadedPkg);
+}
+
+static void RequestEntryDecode(int i)
+{
+    if (decodeRequested[i] || __atomic_load_n(&loadedPkg.entries[i].loadState, __ATOMIC_RELAXED) == PKGENTRY_LOADED) return;
+
+    decodeRequested[i] = true;
+    NewTaskGroupTask(&visibleDecodeGroup, decodecycle, (void *)(intptr_t)i);
+}
+
+typedef struct EntryNameArgs {
+    Package pkg;
+    PropertyNameList *nameList;
+    const char **names;
+} EntryNameArgs;
+
+static void namecycle(int begin, int end, void *ctx)
+{
+    EntryNameArgs *args = ctx;
+
+    for (int i = begin; i < end; i++)
+    {
+        PackageEntry entry = args->pkg.entries[i];
+
+        const char *name = FindPropertyName(*args->nameList, entry.instance);
+        if (!name) name = LookupName(entry.instance);
+        if (name) args->names[i] = name;
+    }
 }
 
 typedef enum {
@@ -502,7 +692,11 @@ int main(int argc, char **argv)
     if (argc > 1 && !strcmp(argv[1], "-debug")) SetTraceLogLevel(LOG_DEBUG); // bit of a hack but as we have only one command-line option it should be fine
                                                                              // too lazy to use getopt
 
-    PropertyNameList nameList = LoadPropertyNameList("Properties.txt");
+    PropertyNameList nameList = GetBuiltinPropertyNameList();
+    // Optional; build_namedict makes it.
+    NameDict nameDict = LoadNameDict(NAMEDICT_FILENAME);
+    SetNameDict(&nameDict);
+    SetEntryCacheBudget(EDITOR_CACHE_BUDGET);
     const char **names = NULL; 
 
     while (!WindowShouldClose())
@@ -520,6 +714,7 @@ int main(int argc, char **argv)
                 {
                     if (hasLoadedPkg)
                     {
+                        StopEntryDecoding();
                         UnloadPackageFile(loadedPkg);
                     }
                     hasLoadedPkg = true;
@@ -528,50 +723,16 @@ int main(int argc, char **argv)
                     ClearBackground(RAYWHITE);
                     DrawText("Loading...", GetScreenWidth() / 2 - MeasureText("Loading...", 20)/2, GetScreenHeight() / 2 - 10, 20, GRAY);
                     EndDrawing();
-                    FILE *f = fopen(path, "rb");
-                    LoadPackageFileAsyncArgs args;
-                    args.f = f;
-                    args.pkg = &loadedPkg;
-                    args.done = false;
-                    pthread_t thread;
-                    pthread_create(&thread, NULL, loadPackageFile_async, &args);
-
-                    while (!args.done)
-                    {
-                        BeginDrawing();
-                        ClearBackground(RAYWHITE);
-                        DrawText(TextFormat("Loading... %d left", GetThreadpoolTasksLeft()), GetScreenWidth() / 2 - MeasureText("Loading...", 20)/2, GetScreenHeight() / 2 - 10, 20, GRAY);
-                        EndDrawing();
-                    }
 
-                    fclose(f);
+                    loadedPkg = LoadDroppedPackage(path);
 
                     free(names);
                     names = calloc(loadedPkg.entryCount, sizeof(char *));
 
-                    for (int i = 0; i < loadedPkg.entryCount; i++)
-                    {
-                        PackageEntry entry = loadedPkg.entries[i];
-                        if (entry.type == PKGENTRY_RAST || entry.type == PKGENTRY_PNG || entry.type == PKGENTRY_GIF && !entry.corrupted)
-                        {
-                            loadedPkg.entries[i].data.imgData.tex = LoadTextureFromImage(entry.data.imgData.img);
-                        }
-
-                        if (entry.type == PKGENTRY_RW4 || !entry.corrupted && entry.data.rw4Data.type == RW4_TEXTURE)
-                        {
-                            loadedPkg.entries[i].data.rw4Data.data.texData.tex = LoadTextureFromImage(entry.data.rw4Data.data.texData.img);
-                        }
-                        
-                        for (int j = 0; j < nameList.propCount; j++)
-                        {
-                            if (entry.instance == nameList.propIds[j])
-                            {
-                                names[i] = nameList.propNames[j];
-                            }
-                        }
-                    }
-
+                    EntryNameArgs nameArgs = { loadedPkg, &nameList, names };
+                    ParallelFor(0, loadedPkg.entryCount, 256, namecycle, &nameArgs);
 
+                    StartEntryDecoding();
                 }
             }
 
@@ -584,18 +745,31 @@ int main(int argc, char **argv)
             {
                 case EXPORT_PACKAGE:
                 {
+                    PauseEntryDecoding();
                     ExportPackage(loadedPkg, TextFormat("%s" PATH_SEPERATOR "%s", fileDialogState.dirPathText, fileDialogState.fileNameText));
+                    ResumeEntryDecoding();
                     fileDialogState.SelectFilePressed = false;
                 } break;
                 case EXPORT_PACKAGE_ENTRY:
                 {
-                    ExportPackageEntry(loadedPkg.entries[selectedPkgEntry], TextFormat("%s" PATH_SEPERATOR "%s", fileDialogState.dirPathText, fileDialogState.fileNameText));
+                    ExportPackageEntry(*GetPackageEntryData(loadedPkg, selectedPkgEntry), TextFormat("%s" PATH_SEPERATOR "%s", fileDialogState.dirPathText, fileDialogState.fileNameText));
                     fileDialogState.SelectFilePressed = false;
                 } break;
                 case IMPORT_FILE_OVERWRITE:
                 {
                     const char *fname = TextFormat("%s" PATH_SEPERATOR "%s", fileDialogState.dirPathText, fileDialogState.fileNameText);
-                    loadedPkg.entries[selectedPkgEntry].dataRaw = LoadFileData(fname, &loadedPkg.entries[selectedPkgEntry].dataRawSize);
+                    int size = 0;
+                    unsigned char *data = LoadFileData(fname, &size);
+
+                    if (data)
+                    {
+                        // Pinned so the cache does not unload it halfway; it
+                        // is decoded again from the entry's copy later on.
+                        PackageEntry *entry = AcquirePackageEntryData(loadedPkg, selectedPkgEntry);
+                        ReplacePackageEntryData(loadedPkg, selectedPkgEntry, data, size);
+                        ReleasePackageEntryData(entry);
+                        UnloadFileData(data);
+                    }
                     fileDialogState.SelectFilePressed = false;
                 } break;
                 case EXPORT_PACKAGE_ENTRY_COMPRESSED:
@@ -626,22 +800,31 @@ int main(int argc, char **argv)
 
             BeginScissorMode(pkgEntryListView.x, pkgEntryListView.y, pkgEntryListView.width, pkgEntryListView.height);
 
+            // Rows on screen jump the decode queue. The selected entry is decoded
+            // on the spot by GetShownPackageEntry.
+            int firstVisible = Clamp((pkgEntryListView.y - pkgEntryListScroll.y) / RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT - 2, 0, loadedPkg.entryCount);
+            int lastVisible = Clamp(firstVisible + pkgEntryListView.height / RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT + 2, 0, loadedPkg.entryCount);
+
+            for (int i = firstVisible; i < lastVisible; i++) RequestEntryDecode(i);
+            TrimEntryCache();
+
             for (int i = 0; i < loadedPkg.entryCount; i++)
             {
                 ListRow row = { 0 };
-                PackageEntry entry = loadedPkg.entries[i];
+                // Only the index fields; workers may be decoding the rest of the entry.
+                const PackageEntry *entry = &loadedPkg.entries[i];
 
                 row.elementCount = 4;
                 row.elementWidth = (float[4]){0.3, 0.3, 0.3, 0.1};
                 row.elementText = (const char*[4]){
-                    TextFormat("%#X (%s)", entry.type, PackageEntryTypeToString(entry.type)),
-                    TextFormat("%#X", entry.instance),
-                    TextFormat("%#X", entry.group),
-                    entry.compressed ? "YES" : "NO"};
+                    TextFormat("%#X (%s)", entry->type, PackageEntryTypeToString(entry->type)),
+                    TextFormat("%#X", entry->instance),
+                    TextFormat("%#X", entry->group),
+                    entry->compressed ? "YES" : "NO"};
                 
                 if (names[i])
                 {
-                    row.elementText[1] = TextFormat("%#X (%s)", entry.instance, names[i]);
+                    row.elementText[1] = TextFormat("%#X (%s)", entry->instance, names[i]);
                 }
 
                 bool shouldToggleSelect = DrawListRow((Rectangle) {
@@ -687,7 +870,7 @@ int main(int argc, char **argv)
             {
                 selectedPkgEntry = Clamp(selectedPkgEntry, 0, loadedPkg.entryCount-1);
 
-                PackageEntry entry = loadedPkg.entries[selectedPkgEntry];
+                PackageEntry entry = *GetShownPackageEntry(selectedPkgEntry);
 
                 if (entry.corrupted)
                 {
@@ -703,6 +886,7 @@ int main(int argc, char **argv)
                     fileDialogReason = EXPORT_PACKAGE_ENTRY;
                     fileDialogState.saveFileMode = true;
                     fileDialogState.windowActive = true;
+                    GetPackageEntryFileName(entry, fileDialogState.fileNameText, sizeof(fileDialogState.fileNameText));
                 }
 
                 if (GuiButton((Rectangle){232, 0, 100, 24}, "Overwrite Entry"))
@@ -738,5 +922,11 @@ int main(int argc, char **argv)
         EndDrawing();
     }
 
+    StopEntryDecoding();
+    CloseSharedThreadpool();
+
+    SetNameDict(NULL);
+    UnloadNameDict(nameDict);
+
     return 0;
 }
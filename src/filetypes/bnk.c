@@ -1,5 +1,6 @@
 #include "filetypes/bnk.h"
 #include "filetypes/wwriff.h"
+#include "threadpool.h"
 #include <stdint.h>
 #include <string.h>
 #include <stdio.h>
@@ -19,8 +20,26 @@ typedef struct ContentIndex {
     uint32_t size;
 } ContentIndex;
 
+typedef struct WaveTaskArgs {
+    unsigned char *data;
+    uint32_t size;
+    Wave *wave;
+} WaveTaskArgs;
+
+static void wavecycle(void *param)
+{
+    WaveTaskArgs *args = param;
+
+    *args->wave = LoadWWRiffWave(args->data, args->size);
+}
+
 // Based on bnkextr: https://github.com/eXpl0it3r/bnkextr
 BnkData LoadBnkData(unsigned char *data, int dataSize)
+{
+    return LoadBnkDataInArena(data, dataSize, NULL);
+}
+
+BnkData LoadBnkDataInArena(unsigned char *data, int dataSize, Arena *arena)
 {
     BnkData bnkData = { 0 };
 
@@ -78,9 +97,7 @@ BnkData LoadBnkData(unsigned char *data, int dataSize)
             data += sizeof(uint32_t);
 
             contentIndexCount = size / sizeof(ContentIndex);
-            contentIndices = malloc(size);
-
-            memcpy(contentIndices, data, size);
+            contentIndices = (ContentIndex *)data;
 
             data += size;
 
@@ -120,20 +137,25 @@ BnkData LoadBnkData(unsigned char *data, int dataSize)
     }
 
     bnkData.waveCount = contentIndexCount;
-    bnkData.waves = malloc(bnkData.waveCount * sizeof(Wave));
+    bnkData.waves = ArenaCalloc(arena, bnkData.waveCount, sizeof(Wave));
+
+    // Each wave converts independently, so fan out one subtask per wave and
+    // help run them until all are done.
+    WaveTaskArgs *waveArgs = malloc(contentIndexCount * sizeof(WaveTaskArgs));
+    TaskGroup group = NewTaskGroup(GetCurrentThreadpool());
 
     for (int i = 0; i < contentIndexCount; i++)
     {
         ContentIndex index = contentIndices[i];
 
-        data = soundDataOffset + index.offset;
+        TRACELOG(LOG_INFO, "BNK: Loading %#X (%d/%d)", index.id, i, contentIndexCount);
 
-        {
-            TRACELOG(LOG_INFO, "BNK: Loading %#X (%d/%d)", index.id, i, contentIndexCount);
-            
-            bnkData.waves[i] = LoadWWRiffWave(data, index.size);
-        }
+        waveArgs[i] = (WaveTaskArgs){ soundDataOffset + index.offset, index.size, &bnkData.waves[i] };
+        NewTaskGroupTask(&group, wavecycle, &waveArgs[i]);
     }
 
+    WaitForTaskGroup(&group);
+    free(waveArgs);
+
     return bnkData;
 }
@@ -0,0 +1,339 @@
+#include "filetypes/entrycache.h"
+#include "filetypes/pkgindex.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <cpl_pthread.h>
+
+typedef struct CachedEntry {
+    PackageEntry *entry;    // NULL while the slot is free.
+    size_t size;
+    int pins;
+    bool referenced;        // Used since the hand last passed.
+    bool evicting;          // Being unloaded outside of the lock.
+    int next;               // Next slot in the same bucket, or in the free list.
+} CachedEntry;
+
+typedef struct EvictedEntry {
+    int slot;
+    PackageEntry *entry;
+} EvictedEntry;
+
+static pthread_mutex_t cacheMutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t entryEvicted = PTHREAD_COND_INITIALIZER;
+static int evictionsInFlight;
+
+static CachedEntry *slots;
+static int slotCount;       // Slots handed out so far, free ones included.
+static int slotCapacity;
+static int freeSlot = -1;
+
+static int *buckets;        // First slot per bucket, -1 when empty.
+static int bucketCount;     // Always a power of two.
+
+static int hand;
+static size_t budget = SIZE_MAX;
+static EntryCacheStats stats;
+
+static void LockEntryCache(void)
+{
+    pthread_mutex_lock(&cacheMutex);
+}
+
+static void UnlockEntryCache(void)
+{
+    pthread_mutex_unlock(&cacheMutex);
+}
+
+// Hashed by TGI, but slots belong to one PackageEntry: the same TGI can be
+// in several loaded packages, or twice in one.
+static unsigned int BucketOf(const PackageEntry *entry)
+{
+    return HashTGI(entry->type, entry->group, entry->instance) & (bucketCount - 1);
+}
+
+static int FindCachedEntry(const PackageEntry *entry)
+{
+    if (!bucketCount) return -1;
+
+    for (int s = buckets[BucketOf(entry)]; s != -1; s = slots[s].next)
+    {
+        if (slots[s].entry == entry) return s;
+    }
+
+    return -1;
+}
+
+// Finds entry's slot, waiting for it to be unloaded first if it is being evicted.
+static int FindLiveCachedEntry(const PackageEntry *entry)
+{
+    int s;
+
+    while ((s = FindCachedEntry(entry)) != -1 && slots[s].evicting)
+    {
+        pthread_cond_wait(&entryEvicted, &cacheMutex);
+    }
+
+    return s;
+}
+
+static void LinkCachedEntry(int s)
+{
+    unsigned int b = BucketOf(slots[s].entry);
+
+    slots[s].next = buckets[b];
+    buckets[b] = s;
+}
+
+static void GrowBuckets(void)
+{
+    bucketCount = bucketCount ? bucketCount * 2 : 256;
+    buckets = realloc(buckets, sizeof(int) * bucketCount);
+
+    for (int b = 0; b < bucketCount; b++) buckets[b] = -1;
+
+    for (int s = 0; s < slotCount; s++)
+    {
+        if (slots[s].entry) LinkCachedEntry(s);
+    }
+}
+
+static int InsertCachedEntry(PackageEntry *entry)
+{
+    int s = freeSlot;
+
+    if (s != -1) freeSlot = slots[s].next;
+    else
+    {
+        if (slotCount == slotCapacity)
+        {
+            slotCapacity = slotCapacity ? slotCapacity * 2 : 256;
+            slots = realloc(slots, sizeof(CachedEntry) * slotCapacity);
+        }
+        s = slotCount++;
+    }
+
+    slots[s] = (CachedEntry){ entry, 0, 0, false, false, -1 };
+    stats.entryCount++;
+
+    if (stats.entryCount > bucketCount) GrowBuckets();
+    else LinkCachedEntry(s);
+
+    return s;
+}
+
+static void RemoveCachedEntry(int s)
+{
+    int *link = &buckets[BucketOf(slots[s].entry)];
+
+    while (*link != s) link = &slots[*link].next;
+    *link = slots[s].next;
+
+    if (slots[s].pins) stats.pinnedCount--;
+    stats.size -= slots[s].size;
+    stats.entryCount--;
+
+    slots[s].entry = NULL;
+    slots[s].next = freeSlot;
+    freeSlot = s;
+}
+
+static void PinCachedEntry(int s)
+{
+    if (slots[s].pins++ == 0) stats.pinnedCount++;
+}
+
+static void UnpinCachedEntry(int s)
+{
+    if (--slots[s].pins == 0) stats.pinnedCount--;
+}
+
+// Textures are uploaded after decoding, so sizes are refreshed on every pin change.
+static void UpdateCachedEntrySize(int s)
+{
+    size_t size = GetPackageEntryDataSize(slots[s].entry);
+
+    stats.size += size - slots[s].size;
+    slots[s].size = size;
+}
+
+// Picks victims until the cache would be within budget. Their size no longer
+// counts, but they stay in the table, marked, until UnloadEvictedEntries.
+// Returns how many were put in *victims, to be freed by the caller.
+static int PickEvictedEntries(EvictedEntry **victims)
+{
+    int count = 0;
+
+    *victims = NULL;
+
+    // Two full turns of the hand: the first may only clear referenced bits.
+    for (int steps = 0; stats.size > budget && steps < 2 * slotCount; steps++)
+    {
+        if (hand >= slotCount) hand = 0;
+
+        int s = hand++;
+
+        if (!slots[s].entry || slots[s].pins || slots[s].evicting) continue;
+
+        if (slots[s].referenced)
+        {
+            slots[s].referenced = false;
+            continue;
+        }
+
+        if (!*victims) *victims = malloc(sizeof(EvictedEntry) * slotCount);
+
+        (*victims)[count++] = (EvictedEntry){ s, slots[s].entry };
+        slots[s].evicting = true;
+        stats.size -= slots[s].size;
+        slots[s].size = 0;
+    }
+
+    evictionsInFlight += count;
+
+    return count;
+}
+
+// Called with the lock held, which is released while the victims are
+// unloaded: unloading textures and arenas is slow, and lookups of other
+// entries should not wait on it.
+static void UnloadEvictedEntries(EvictedEntry *victims, int count)
+{
+    if (!count) return;
+
+    UnlockEntryCache();
+
+    for (int i = 0; i < count; i++) UnloadPackageEntryData(victims[i].entry);
+
+    LockEntryCache();
+
+    for (int i = 0; i < count; i++) RemoveCachedEntry(victims[i].slot);
+
+    stats.evictions += count;
+    evictionsInFlight -= count;
+    pthread_cond_broadcast(&entryEvicted);
+
+    free(victims);
+}
+
+static void TrimEntryCacheLocked(void)
+{
+    EvictedEntry *victims;
+    int count = PickEvictedEntries(&victims);
+
+    UnloadEvictedEntries(victims, count);
+}
+
+void SetEntryCacheBudget(size_t size)
+{
+    LockEntryCache();
+    budget = size;
+    UnlockEntryCache();
+}
+
+PackageEntry *AcquirePackageEntryData(Package pkg, int i)
+{
+    PackageEntry *entry = &pkg.entries[i];
+
+    LockEntryCache();
+
+    int s = FindLiveCachedEntry(entry);
+    if (s != -1) stats.hits++;
+    else
+    {
+        stats.misses++;
+        s = InsertCachedEntry(entry);
+    }
+
+    PinCachedEntry(s);
+    slots[s].referenced = true;
+
+    UnlockEntryCache();
+
+    // Pinned, so nobody unloads it while it is decoded.
+    GetPackageEntryData(pkg, i);
+
+    LockEntryCache();
+    UpdateCachedEntrySize(s);
+    TrimEntryCacheLocked();
+    UnlockEntryCache();
+
+    return entry;
+}
+
+void ReleasePackageEntryData(PackageEntry *entry)
+{
+    LockEntryCache();
+
+    int s = FindCachedEntry(entry);
+    if (s != -1 && slots[s].pins)
+    {
+        UpdateCachedEntrySize(s);
+        UnpinCachedEntry(s);
+    }
+
+    UnlockEntryCache();
+}
+
+bool PrefetchPackageEntryData(Package pkg, int i)
+{
+    PackageEntry *entry = &pkg.entries[i];
+
+    LockEntryCache();
+
+    if (stats.size > budget || FindCachedEntry(entry) != -1)
+    {
+        bool full = stats.size > budget;
+        UnlockEntryCache();
+        return !full;
+    }
+
+    // Not referenced: entries nobody looked at yet are the first to go.
+    int s = InsertCachedEntry(entry);
+    PinCachedEntry(s);
+
+    UnlockEntryCache();
+
+    GetPackageEntryData(pkg, i);
+
+    LockEntryCache();
+    UpdateCachedEntrySize(s);
+    UnpinCachedEntry(s);
+    bool full = stats.size > budget;
+    UnlockEntryCache();
+
+    return !full;
+}
+
+void TrimEntryCache(void)
+{
+    LockEntryCache();
+    TrimEntryCacheLocked();
+    UnlockEntryCache();
+}
+
+void RemovePackageFromEntryCache(Package pkg)
+{
+    LockEntryCache();
+
+    // Evictions still unloading may be pkg's.
+    while (evictionsInFlight) pthread_cond_wait(&entryEvicted, &cacheMutex);
+
+    for (int s = 0; s < slotCount; s++)
+    {
+        if (slots[s].entry >= pkg.entries && slots[s].entry < pkg.entries + pkg.entryCount) RemoveCachedEntry(s);
+    }
+
+    UnlockEntryCache();
+}
+
+EntryCacheStats GetEntryCacheStats(void)
+{
+    LockEntryCache();
+
+    EntryCacheStats ret = stats;
+    ret.budget = budget;
+
+    UnlockEntryCache();
+
+    return ret;
+}
@@ -1,4 +1,5 @@
 #include "filetypes/heightmap.h"
+#include "threadpool.h"
 #include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
@@ -18,6 +19,30 @@ Color eight2col(uint8_t d)
     return (Color){d, d, d, 255};
 }
 
+// Samples per chunk when the channels are split across threads.
+#define HEIGHTMAP_CHANNEL_GRAIN 4096
+
+typedef struct ChannelSplitArgs {
+    const uint32_t *data32;
+    Color **imgDatas;
+} ChannelSplitArgs;
+
+static void channelcycle(int begin, int end, void *ctx)
+{
+    ChannelSplitArgs *args = ctx;
+
+    for (int i = begin; i < end; i++)
+    {
+        uint32_t asint = args->data32[i];
+        uint8_t *as8s = (uint8_t *)&asint;
+
+        args->imgDatas[0][i] = eight2col(as8s[0]);
+        args->imgDatas[1][i] = eight2col(as8s[1]);
+        args->imgDatas[2][i] = eight2col(as8s[2]);
+        args->imgDatas[3][i] = eight2col(as8s[3]);
+    }
+}
+
 HeightmapData LoadHeightmapData(unsigned char *data, int dataSize)
 {
     HeightmapData heightmapData = { 0 };
@@ -36,17 +61,8 @@ HeightmapData LoadHeightmapData(unsigned char *data, int dataSize)
     uint32_t *data32 = (uint32_t *)data;
     TRACELOG(LOG_DEBUG, "w %d h %d\n", header->height, header->width);
 
-    for (int i = 0; i < 0x4000; i++)
-    {
-        uint32_t asint = data32[i];
-        TRACELOGNONL(LOG_DEBUG, "%08x ", asint);
-        uint8_t *as8s = (uint8_t *)&asint;
-
-        imgDatas[0][i] = eight2col(as8s[0]);
-        imgDatas[1][i] = eight2col(as8s[1]);
-        imgDatas[2][i] = eight2col(as8s[2]);
-        imgDatas[3][i] = eight2col(as8s[3]);
-    }
+    ChannelSplitArgs args = { data32, imgDatas };
+    ParallelFor(0, 0x4000, HEIGHTMAP_CHANNEL_GRAIN, channelcycle, &args);
 
     Image imgs[4];
 
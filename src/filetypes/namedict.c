@@ -0,0 +1,527 @@
+#include "filetypes/namedict.h"
+#include "filetypes/pkgstream.h"
+#include "hash.h"
+#include "threadpool.h"
+#include <stdlib.h>
+#include <string.h>
+#include <cpl_raylib.h>
+
+#define NAMEDICT_VERSION 1
+#define NAMEDICT_BUCKET_COUNT (1 << NAMEDICT_BUCKET_BITS)
+
+// Names per ParallelFor chunk, and per TheHashBatch call within one.
+#define NAMEDICT_HASH_GRAIN 8192
+#define NAMEDICT_HASH_BATCH 256
+
+typedef struct NameCandidate {
+    uint64_t fingerprint;   // Exact bytes, to drop duplicates as they come in.
+    uint32_t offset;        // Into text.
+    uint32_t length;
+    uint32_t id;            // Set up front for named ids, by BuildNameDict for the rest.
+    bool named;
+} NameCandidate;
+
+struct NameDictBuilder {
+    char *text;             // Every name, null-terminated.
+    size_t textSize;
+    size_t textCapacity;
+
+    NameCandidate *names;
+    int nameCount;
+    int nameCapacity;
+
+    int *slots;             // Open addressing over the candidates, -1 when empty.
+    int slotCount;          // Always a power of two.
+};
+
+static const NameDict *activeDict;
+
+NameDictBuilder *CreateNameDictBuilder(void)
+{
+    NameDictBuilder *builder = calloc(1, sizeof(NameDictBuilder));
+
+    builder->slotCount = 1024;
+    builder->slots = malloc(sizeof(int) * builder->slotCount);
+    for (int s = 0; s < builder->slotCount; s++) builder->slots[s] = -1;
+
+    return builder;
+}
+
+static int AppendName(NameDictBuilder *builder, const char *name, int length)
+{
+    if (builder->textSize + length + 1 > UINT32_MAX) return -1;
+
+    if (builder->textSize + length + 1 > builder->textCapacity)
+    {
+        builder->textCapacity = builder->textCapacity ? builder->textCapacity * 2 : 65536;
+        if (builder->textCapacity < builder->textSize + length + 1) builder->textCapacity = builder->textSize + length + 1;
+        builder->text = realloc(builder->text, builder->textCapacity);
+    }
+
+    if (builder->nameCount == builder->nameCapacity)
+    {
+        builder->nameCapacity = builder->nameCapacity ? builder->nameCapacity * 2 : 4096;
+        builder->names = realloc(builder->names, sizeof(NameCandidate) * builder->nameCapacity);
+    }
+
+    NameCandidate *candidate = &builder->names[builder->nameCount];
+
+    *candidate = (NameCandidate){ .offset = builder->textSize, .length = length };
+    memcpy(builder->text + builder->textSize, name, length);
+    builder->text[builder->textSize + length] = 0;
+    builder->textSize += length + 1;
+
+    return builder->nameCount++;
+}
+
+static void GrowSlots(NameDictBuilder *builder)
+{
+    builder->slotCount *= 2;
+    builder->slots = realloc(builder->slots, sizeof(int) * builder->slotCount);
+    for (int s = 0; s < builder->slotCount; s++) builder->slots[s] = -1;
+
+    for (int i = 0; i < builder->nameCount; i++)
+    {
+        if (builder->names[i].named) continue;
+
+        int s = builder->names[i].fingerprint & (builder->slotCount - 1);
+        while (builder->slots[s] != -1) s = (s + 1) & (builder->slotCount - 1);
+        builder->slots[s] = i;
+    }
+}
+
+void AddNameCandidate(NameDictBuilder *builder, const char *name, int length)
+{
+    if (length <= 0 || length > NAMEDICT_MAX_NAME) return;
+
+    uint64_t fingerprint = HashData64(name, length);
+    int s = fingerprint & (builder->slotCount - 1);
+
+    for (; builder->slots[s] != -1; s = (s + 1) & (builder->slotCount - 1))
+    {
+        NameCandidate *other = &builder->names[builder->slots[s]];
+
+        if (other->fingerprint == fingerprint && other->length == (uint32_t)length && !memcmp(builder->text + other->offset, name, length)) return;
+    }
+
+    int i = AppendName(builder, name, length);
+    if (i == -1) return;
+
+    builder->names[i].fingerprint = fingerprint;
+    builder->slots[s] = i;
+
+    // At most half full, so probes stay short.
+    if (builder->nameCount * 2 > builder->slotCount) GrowSlots(builder);
+}
+
+void AddNamedId(NameDictBuilder *builder, uint32_t id, const char *name)
+{
+    int length = strlen(name);
+    if (length <= 0 || length > NAMEDICT_MAX_NAME) return;
+
+    int i = AppendName(builder, name, length);
+    if (i == -1) return;
+
+    builder->names[i].id = id;
+    builder->names[i].named = true;
+}
+
+void AddPropertyNames(NameDictBuilder *builder, PropertyNameList nameList)
+{
+    for (int i = 0; i < nameList.propCount; i++)
+    {
+        AddNamedId(builder, nameList.propIds[i], nameList.propNames[i]);
+        AddNameCandidate(builder, nameList.propNames[i], strlen(nameList.propNames[i]));
+    }
+}
+
+static bool IsLetter(unsigned char c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+}
+
+static bool IsNameChar(unsigned char c)
+{
+    return IsLetter(c) || (c >= '0' && c <= '9') || c == '_' || c == '-' || c == '.' || c == '/' || c == '\\';
+}
+
+static bool IsNameEdge(unsigned char c)
+{
+    return c == '-' || c == '.' || c == '/' || c == '\\';
+}
+
+// The name, and for paths also the file name and the file name without extension.
+static void AddNameVariants(NameDictBuilder *builder, const char *start, const char *end)
+{
+    const char *base = start;
+    const char *dot = NULL;
+
+    for (const char *p = start; p < end; p++)
+    {
+        if (*p == '/' || *p == '\\')
+        {
+            base = p + 1;
+            dot = NULL;
+        }
+        if (*p == '.') dot = p;
+    }
+
+    AddNameCandidate(builder, start, end - start);
+    if (base != start) AddNameCandidate(builder, base, end - base);
+    if (dot) AddNameCandidate(builder, base, dot - base);
+}
+
+static void AddToken(NameDictBuilder *builder, const char *start, const char *end)
+{
+    while (start < end && IsNameEdge(*start)) start++;
+    while (end > start && IsNameEdge(end[-1])) end--;
+
+    for (const char *p = start; p < end; p++)
+    {
+        if (IsLetter(*p))
+        {
+            AddNameVariants(builder, start, end);
+            return;
+        }
+    }
+}
+
+bool AddNameWordlist(NameDictBuilder *builder, const char *filename)
+{
+    MappedFile map = MapFileFromPath(filename);
+
+    if (!IsFileMapped(map))
+    {
+        TRACELOG(LOG_ERROR, "%s: cannot read the wordlist.\n", filename);
+        return false;
+    }
+
+    const char *p = (const char *)map.data;
+    const char *end = p + map.size;
+
+    while (p < end)
+    {
+        const char *line = p;
+        const char *eol = memchr(p, '\n', end - p);
+
+        if (!eol) eol = end;
+        p = eol + 1;
+
+        while (eol > line && (eol[-1] == '\r' || eol[-1] == ' ' || eol[-1] == '\t')) eol--;
+        while (line < eol && (*line == ' ' || *line == '\t')) line++;
+
+        if (eol > line) AddNameVariants(builder, line, eol);
+    }
+
+    UnmapFile(map);
+
+    return true;
+}
+
+void AddNamesFromText(NameDictBuilder *builder, const char *text, size_t size)
+{
+    const char *p = text;
+    const char *end = text + size;
+
+    while (p < end)
+    {
+        while (p < end && !IsNameChar(*p)) p++;
+
+        const char *start = p;
+        while (p < end && IsNameChar(*p)) p++;
+
+        if (p > start) AddToken(builder, start, p);
+    }
+}
+
+static void AddNamesFromProps(NameDictBuilder *builder, PropData propData)
+{
+    for (unsigned int i = 0; i < propData.variableCount; i++)
+    {
+        PropVariable var = propData.variables[i];
+
+        if (var.type != PROPVAR_STR8 && var.type != PROPVAR_STRING) continue;
+
+        for (unsigned int j = 0; j < var.count; j++)
+        {
+            // Same layout for both: 0x13 keeps the low byte of each character.
+            const char *str = var.type == PROPVAR_STR8 ? var.values[j].string8 : var.values[j].string;
+            if (str) AddNamesFromText(builder, str, strlen(str));
+        }
+    }
+}
+
+static bool harvestcycle(PackageEntry *entry, void *ctx)
+{
+    NameDictBuilder *builder = ctx;
+
+    if (entry->corrupted) return true;
+
+    switch (entry->type)
+    {
+        case PKGENTRY_ER2:
+        case PKGENTRY_HTML:
+        case PKGENTRY_CSS:
+        case PKGENTRY_JSN8:
+        case PKGENTRY_SCPT:
+        case PKGENTRY_TEXT:
+        case PKGENTRY_JSON:
+        {
+            if (entry->data.scriptSource) AddNamesFromText(builder, entry->data.scriptSource, strlen(entry->data.scriptSource));
+        } break;
+        case PKGENTRY_PROP: AddNamesFromProps(builder, entry->data.propData); break;
+    }
+
+    return true;
+}
+
+int AddNamesFromPackageFile(NameDictBuilder *builder, FILE *f)
+{
+    return ScanPackageFile(f, harvestcycle, builder);
+}
+
+typedef struct HashCycleArgs {
+    NameDictBuilder *builder;
+} HashCycleArgs;
+
+static void hashcycle(int begin, int end, void *ctx)
+{
+    HashCycleArgs *args = ctx;
+    NameDictBuilder *builder = args->builder;
+    const char *strs[NAMEDICT_HASH_BATCH];
+    size_t lengths[NAMEDICT_HASH_BATCH];
+    uint32_t hashes[NAMEDICT_HASH_BATCH];
+
+    for (int i = begin; i < end; i += NAMEDICT_HASH_BATCH)
+    {
+        int count = end - i < NAMEDICT_HASH_BATCH ? end - i : NAMEDICT_HASH_BATCH;
+
+        for (int k = 0; k < count; k++)
+        {
+            strs[k] = builder->text + builder->names[i + k].offset;
+            lengths[k] = builder->names[i + k].length;
+        }
+
+        TheHashBatch(strs, lengths, count, hashes);
+
+        for (int k = 0; k < count; k++)
+        {
+            if (!builder->names[i + k].named) builder->names[i + k].id = hashes[k];
+        }
+    }
+}
+
+typedef struct SortedName {
+    uint32_t hash;
+    int index;
+} SortedName;
+
+// By hash, then in the order the names were added.
+static int CompareSortedNames(const void *a, const void *b)
+{
+    const SortedName *x = a, *y = b;
+
+    if (x->hash != y->hash) return x->hash < y->hash ? -1 : 1;
+    return x->index - y->index;
+}
+
+// TheHash does not see case, so neither do duplicates.
+static bool SameNameIgnoringCase(const char *a, const char *b, int length)
+{
+    for (int i = 0; i < length; i++)
+    {
+        unsigned char x = a[i], y = b[i];
+
+        if (x >= 'A' && x <= 'Z') x += 32;
+        if (y >= 'A' && y <= 'Z') y += 32;
+        if (x != y) return false;
+    }
+
+    return true;
+}
+
+static NameDict GetNameDictFromData(unsigned char *data)
+{
+    NameDict dict = { 0 };
+
+    dict.header = (const NameDictHeader *)data;
+    dict.buckets = (const uint32_t *)(dict.header + 1);
+    dict.hashes = dict.buckets + NAMEDICT_BUCKET_COUNT + 1;
+    dict.offsets = dict.hashes + dict.header->nameCount;
+    dict.strings = (const char *)(dict.offsets + dict.header->nameCount);
+
+    return dict;
+}
+
+static size_t GetNameDictSize(uint32_t nameCount, uint32_t stringsSize)
+{
+    return sizeof(NameDictHeader) + sizeof(uint32_t) * (NAMEDICT_BUCKET_COUNT + 1) + sizeof(uint32_t) * 2 * (size_t)nameCount + stringsSize;
+}
+
+NameDict BuildNameDict(NameDictBuilder *builder)
+{
+    HashCycleArgs args = { builder };
+    ParallelFor(0, builder->nameCount, NAMEDICT_HASH_GRAIN, hashcycle, &args);
+
+    SortedName *sorted = malloc(sizeof(SortedName) * (builder->nameCount + 1));
+
+    for (int i = 0; i < builder->nameCount; i++) sorted[i] = (SortedName){ builder->names[i].id, i };
+
+    qsort(sorted, builder->nameCount, sizeof(SortedName), CompareSortedNames);
+
+    // Drops names that only differ in case from one kept for the same hash.
+    int kept = 0;
+    size_t stringsSize = 0;
+
+    for (int i = 0, run = 0; i < builder->nameCount; i++)
+    {
+        if (i == 0 || sorted[i].hash != sorted[i - 1].hash) run = kept;
+
+        NameCandidate *name = &builder->names[sorted[i].index];
+        bool duplicate = false;
+
+        for (int k = run; k < kept && !duplicate; k++)
+        {
+            NameCandidate *other = &builder->names[sorted[k].index];
+            duplicate = other->length == name->length && SameNameIgnoringCase(builder->text + other->offset, builder->text + name->offset, name->length);
+        }
+
+        if (duplicate) continue;
+
+        sorted[kept++] = sorted[i];
+        stringsSize += name->length + 1;
+    }
+
+    unsigned char *data = malloc(GetNameDictSize(kept, stringsSize));
+
+    *(NameDictHeader *)data = (NameDictHeader){ .magic = "OSND", .version = NAMEDICT_VERSION, .nameCount = kept, .stringsSize = stringsSize };
+
+    NameDict dict = GetNameDictFromData(data);
+    uint32_t *buckets = (uint32_t *)dict.buckets;
+    uint32_t *hashes = (uint32_t *)dict.hashes;
+    uint32_t *offsets = (uint32_t *)dict.offsets;
+    char *strings = (char *)dict.strings;
+    uint32_t offset = 0;
+
+    for (int i = 0, b = 0; i <= kept; i++)
+    {
+        int top = i < kept ? sorted[i].hash >> (32 - NAMEDICT_BUCKET_BITS) : NAMEDICT_BUCKET_COUNT;
+        while (b <= top) buckets[b++] = i;
+
+        if (i == kept) break;
+
+        NameCandidate *name = &builder->names[sorted[i].index];
+
+        hashes[i] = sorted[i].hash;
+        offsets[i] = offset;
+        memcpy(strings + offset, builder->text + name->offset, name->length + 1);
+        offset += name->length + 1;
+    }
+
+    dict.data = data;
+
+    TRACELOG(LOG_INFO, "Name dictionary: %d names from %d candidates.\n", kept, builder->nameCount);
+
+    free(sorted);
+    free(builder->text);
+    free(builder->names);
+    free(builder->slots);
+    free(builder);
+
+    return dict;
+}
+
+NameDict LoadNameDict(const char *filename)
+{
+    NameDict dict = { 0 };
+    MappedFile mapping = MapFileFromPath(filename);
+
+    if (!IsFileMapped(mapping)) return dict;
+
+    const NameDictHeader *header = (const NameDictHeader *)mapping.data;
+    bool valid = mapping.size >= sizeof(NameDictHeader) && !memcmp(header->magic, "OSND", 4) && header->version == NAMEDICT_VERSION &&
+                 mapping.size == GetNameDictSize(header->nameCount, header->stringsSize);
+
+    if (valid)
+    {
+        dict = GetNameDictFromData(mapping.data);
+
+        // Lookups trust the buckets, and every string must end inside the table.
+        valid = dict.buckets[NAMEDICT_BUCKET_COUNT] == header->nameCount && (!header->stringsSize || !dict.strings[header->stringsSize - 1]);
+        for (int b = 0; valid && b < NAMEDICT_BUCKET_COUNT; b++) valid = dict.buckets[b] <= dict.buckets[b + 1];
+    }
+
+    if (!valid)
+    {
+        TRACELOG(LOG_WARNING, "%s: not a valid name dictionary, ignoring it.\n", filename);
+        UnmapFile(mapping);
+        return (NameDict){ 0 };
+    }
+
+    dict.mapping = mapping;
+
+    TRACELOG(LOG_INFO, "Loaded %u names from %s.\n", header->nameCount, filename);
+
+    return dict;
+}
+
+bool SaveNameDict(NameDict dict, const char *filename)
+{
+    if (!dict.header) return false;
+
+    FILE *f = fopen(filename, "wb");
+
+    if (!f)
+    {
+        perror(filename);
+        return false;
+    }
+
+    fwrite(dict.header, GetNameDictSize(dict.header->nameCount, dict.header->stringsSize), 1, f);
+
+    bool ok = !ferror(f);
+    fclose(f);
+
+    return ok;
+}
+
+void UnloadNameDict(NameDict dict)
+{
+    if (IsFileMapped(dict.mapping)) UnmapFile(dict.mapping);
+    free(dict.data);
+}
+
+const char *LookupNameDict(NameDict dict, uint32_t hash)
+{
+    if (!dict.header) return NULL;
+
+    uint32_t b = hash >> (32 - NAMEDICT_BUCKET_BITS);
+    uint32_t lo = dict.buckets[b], hi = dict.buckets[b + 1], end = hi;
+
+    while (lo < hi)
+    {
+        uint32_t mid = lo + (hi - lo) / 2;
+
+        if (dict.hashes[mid] < hash) lo = mid + 1;
+        else hi = mid;
+    }
+
+    if (lo == end || dict.hashes[lo] != hash || dict.offsets[lo] >= dict.header->stringsSize) return NULL;
+
+    return dict.strings + dict.offsets[lo];
+}
+
+int GetNameDictCount(NameDict dict)
+{
+    return dict.header ? dict.header->nameCount : 0;
+}
+
+void SetNameDict(const NameDict *dict)
+{
+    activeDict = dict;
+}
+
+const char *LookupName(uint32_t hash)
+{
+    return activeDict ? LookupNameDict(*activeDict, hash) : NULL;
+}
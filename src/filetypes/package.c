@@ -8,58 +8,19 @@
 #include "filetypes/wwriff.h"
 #include <threadpool.h>
 #include <cpl_pthread.h>
+#include <cpl_pread.h>
 #include <ctype.h>
 #include <sys/stat.h>
 #include "memstream.h"
+#include "filetypes/pkgindex.h"
+#include "filetypes/dbpf.h"
+#include "filetypes/pkgdedup.h"
+#include "filetypes/namedict.h"
 
 #ifdef __linux__
 #define mkdir(x) mkdir(x, 0777)
 #endif
 
-typedef struct PackageHeader {
-    char magic[4];              //00
-    uint32_t majorVersion;      //04
-    uint32_t minorVersion;      //08
-    uint32_t unknown[3];        //0C
-    uint32_t dateCreated;       //18
-    uint32_t dateModified;      //1C
-    uint32_t indexMajorVersion; //20
-    uint32_t indexEntryCount;   //24
-    uint32_t firstIndexEntryOffset; //28
-    uint32_t indexSize;         //2C
-    uint32_t holeEntryCount;    //30
-    uint32_t holeOffset;        //34
-    uint32_t holeSize;          //38
-    uint32_t indexMinorVersion; //3C
-    uint32_t indexOffset;       //40
-    uint32_t unknown2;          //44
-    unsigned char reserved[24]; //48
-                                //5C
-} PackageHeader;
-
-typedef struct IndexEntry {
-    uint32_t type;
-    uint32_t group;
-    uint32_t instance;
-    uint32_t chunkOffset;
-    uint32_t diskSize;
-    uint32_t memSize;
-    uint16_t compressed;
-    uint16_t unknown;
-    
-    bool isCompressed;
-} IndexEntry;
-
-typedef struct IndexData {
-    uint32_t null;
-} IndexData;
-
-typedef struct Index {
-    uint32_t indexType;
-    
-    IndexData data;
-} Index;
-
 static void readuint(uint32_t *ret, FILE *f)
 {
     fread(ret, sizeof(uint32_t), 1, f);
@@ -77,13 +38,13 @@ static bool ProcessPackageData(unsigned char *data, int dataSize, uint32_t dataT
     {
         case PKGENTRY_PROP: // Properties files https://simswiki.info/wiki.php?title=Spore:00B1B104
         {
-            PropData propData = LoadPropData(data, dataSize);
+            PropData propData = LoadPropDataInArena(data, dataSize, &pkgEntry->arena);
             pkgEntry->data.propData = propData;
             return !propData.corrupted;
         } break;
         case PKGENTRY_RAST: // Raster file https://simswiki.info/wiki.php?title=Spore:2F4E681C
         {
-            RastData rastData = LoadRastData(data, dataSize);
+            RastData rastData = LoadRastDataInArena(data, dataSize, &pkgEntry->arena);
             pkgEntry->data.imgData.img = rastData.img;
             //if (!rastData.corrupted)
             //{
@@ -100,7 +61,7 @@ static bool ProcessPackageData(unsigned char *data, int dataSize, uint32_t dataT
         case PKGENTRY_JSON: // JSON file.
         {
             TRACELOG(LOG_DEBUG, "Text:\n");
-            char *str = malloc(dataSize);
+            char *str = ArenaAlloc(&pkgEntry->arena, dataSize + 1);
             int actualSize = 0;
 
             // Filter out these disgusting UTF-8 characters.
@@ -111,7 +72,6 @@ static bool ProcessPackageData(unsigned char *data, int dataSize, uint32_t dataT
                 actualSize++;
             }
 
-            str = realloc(str, actualSize + 1);
             str[actualSize] = 0;
 
             TRACELOG(LOG_DEBUG, "%s\n", str);
@@ -148,7 +108,7 @@ static bool ProcessPackageData(unsigned char *data, int dataSize, uint32_t dataT
         } break;
         case PKGENTRY_BNK:
         {
-            pkgEntry->data.bnkData = LoadBnkData(data, dataSize);
+            pkgEntry->data.bnkData = LoadBnkDataInArena(data, dataSize, &pkgEntry->arena);
             return !pkgEntry->data.bnkData.corrupted;
         } break;
         case PKGENTRY_GIF:
@@ -175,132 +135,52 @@ static bool ProcessPackageData(unsigned char *data, int dataSize, uint32_t dataT
     return true;
 }
 
-/**
- * @brief Decompress a RefPack bitstream
- * @param indata - (optional) Pointer to the input RefPack bitstream; may be
- *	NULL
- * @param bytes_read_out - (optional) Pointer to a size_t which will be filled
- *	with the total number of bytes read from the RefPack bitstream; may be
- *	NULL
- * @param outdata - Pointer to the output buffer which will be filled with the
- *	decompressed data; outdata may be NULL only if indata is also NULL
- * @return The value of the "decompressed size" field in the RefPack bitstream,
- *	or 0 if indata is NULL
- *
- * This function is a verbatim translation from x86 assembly into C (with
- * new names and comments supplied) of the RefPack decompression function
- * located at TSOServiceClientD_base+0x724fd in The Sims Online New & Improved
- * Trial.
- *
- * This function ***does not*** perform any bounds-checking on reading or
- * writing. It is inappropriate to use this function on untrusted data obtained
- * from the internet (even though that is exactly what The Sims Online does...).
- * Here are the potential problems:
- * - This function will read past the end of indata if the last command in
- *   indata tells it to.
- * - This function will write past the end of outdata if indata tells it to.
- * - This function will read before the beginning of outdata if indata tells
- *   it to.
- */
-size_t refpack_decompress_unsafe(const uint8_t *indata, size_t *bytes_read_out,
-	uint8_t *outdata)
-{
-	const uint8_t *in_ptr;
-	uint8_t *out_ptr;
-	uint16_t signature;
-	uint32_t decompressed_size = 0;
-	uint8_t byte_0, byte_1, byte_2, byte_3;
-	uint32_t proc_len, ref_len;
-	uint8_t *ref_ptr;
-	uint32_t i;
- 
-	in_ptr = indata, out_ptr = outdata;
-	if (!in_ptr)
-		goto done;
- 
-	signature = ((in_ptr[0] << 8) | in_ptr[1]), in_ptr += 2;
-	if (signature & 0x0100)
-		in_ptr += 3; /* skip over the compressed size field */
- 
-	decompressed_size = ((in_ptr[0] << 16) | (in_ptr[1] << 8) | in_ptr[2]);
-	in_ptr += 3;
- 
-	while (1) {
-		byte_0 = *in_ptr++;
-		if (!(byte_0 & 0x80)) {
-			/* 2-byte command: 0DDRRRPP DDDDDDDD */
-			byte_1 = *in_ptr++;
- 
-			proc_len = byte_0 & 0x03;
-			for (i = 0; i < proc_len; i++)
-				*out_ptr++ = *in_ptr++;
- 
-			ref_ptr = out_ptr - ((byte_0 & 0x60) << 3) - byte_1 - 1;
-			ref_len = ((byte_0 >> 2) & 0x07) + 3;
-			for (i = 0; i < ref_len; i++)
-				*out_ptr++ = *ref_ptr++;
-		} else if(!(byte_0 & 0x40)) {
-			/* 3-byte command: 10RRRRRR PPDDDDDD DDDDDDDD */
-			byte_1 = *in_ptr++;
-			byte_2 = *in_ptr++;
- 
-			proc_len = byte_1 >> 6;
-			for (i = 0; i < proc_len; i++)
-				*out_ptr++ = *in_ptr++;
- 
-			ref_ptr = out_ptr - ((byte_1 & 0x3f) << 8) - byte_2 - 1;
-			ref_len = (byte_0 & 0x3f) + 4;
-			for (i = 0; i < ref_len; i++)
-				*out_ptr++ = *ref_ptr++;
-		} else if(!(byte_0 & 0x20)) {
-			/* 4-byte command: 110DRRPP DDDDDDDD DDDDDDDD RRRRRRRR*/
-			byte_1 = *in_ptr++;
-			byte_2 = *in_ptr++;
-			byte_3 = *in_ptr++;
- 
-			proc_len = byte_0 & 0x03;
-			for (i = 0; i < proc_len; i++)
-				*out_ptr++ = *in_ptr++;
- 
-			ref_ptr = out_ptr - ((byte_0 & 0x10) << 12)
-				- (byte_1 << 8) - byte_2 - 1;
-			ref_len = ((byte_0 & 0x0c) << 6) + byte_3 + 5;
-			for (i = 0; i < ref_len; i++)
-				*out_ptr++ = *ref_ptr++;
-		} else {
-			/* 1-byte command: 111PPPPP */
-			proc_len = (byte_0 & 0x1f) * 4 + 4;
-			if (proc_len <= 0x70) {
-				/* no stop flag */
-				for (i = 0; i < proc_len; i++)
-					*out_ptr++ = *in_ptr++;
-			} else {
-				/* stop flag */
-				proc_len = byte_0 & 0x3;
-				for (i = 0; i < proc_len; i++)
-					*out_ptr++ = *in_ptr++;
- 
-				break;
-			}
-		}
-	}
- 
-done:
-	if (bytes_read_out)
-		*bytes_read_out = in_ptr - indata;
-	return decompressed_size;
+bool DecompressDBPFInto(unsigned char *data, int dataSize, unsigned char *out, int outDataSize)
+{
+    ptrdiff_t written = refpack_decompress(data, dataSize, out, outDataSize);
+    if (written < 0)
+    {
+        TRACELOG(LOG_WARNING, "Malformed RefPack stream (%d bytes, expected %d decompressed).\n", dataSize, outDataSize);
+        return false;
+    }
+
+    // A stream that ends early leaves the rest of the entry zeroed.
+    memset(out + written, 0, outDataSize - written);
+
+    return true;
 }
 
 unsigned char *DecompressDBPF(unsigned char *data, int dataSize, int outDataSize)
 {
     unsigned char *ret = malloc(outDataSize);
-    unsigned char *initData = data;
 
-    refpack_decompress_unsafe(data, NULL, ret);
+    if (!DecompressDBPFInto(data, dataSize, ret, outDataSize))
+    {
+        free(ret);
+        return NULL;
+    }
 
     return ret;
 }
 
+unsigned char *CompressDBPF(unsigned char *data, int dataSize, int *outDataSize, int level)
+{
+    // Anything that does not come out smaller is better stored.
+    if (dataSize <= 1) return NULL;
+
+    unsigned char *ret = malloc(dataSize - 1);
+
+    ptrdiff_t written = refpack_compress(data, dataSize, ret, dataSize - 1, level);
+    if (written < 0)
+    {
+        free(ret);
+        return NULL;
+    }
+
+    *outDataSize = written;
+    return realloc(ret, written);
+}
+
 static const char *GetExtensionFromType(unsigned int type)
 {
     switch (type)
@@ -326,40 +206,84 @@ static const char *GetExtensionFromType(unsigned int type)
     }
 }
 
+void GetPackageEntryFileName(PackageEntry entry, char *buf, int size)
+{
+    const char *name = LookupName(entry.instance);
+    const char *ext = GetExtensionFromType(entry.type);
+
+    if (!name)
+    {
+        snprintf(buf, size, "%#X.%s", entry.instance, ext);
+        return;
+    }
+
+    char dotExt[16];
+    snprintf(dotExt, sizeof(dotExt), ".%s", ext);
+
+    // Names are often paths, and may carry their extension already.
+    if (IsFileExtension(name, dotExt)) snprintf(buf, size, "%s", name);
+    else snprintf(buf, size, "%s%s", name, dotExt);
+
+    for (char *p = buf; *p; p++) if (*p == '/' || *p == '\\' || *p == ':') *p = '_';
+}
+
 static bool writeCorrupted = true;
 
+// Shared by every datacycle task. Tasks claim runs of order, which is sorted
+// by chunkOffset so the file is read front to back.
 typedef struct DataCycleArgs {
     FILE *f;
-    int i;
+    int *order;
     IndexEntry *entries;
+    unsigned char *chunks;  // Copies of every chunk, laid out in order.
+    size_t *chunkCopies;    // Per entry, where its copy starts in chunks.
     Package *pkg;
     pthread_mutex_t *fmutex;
+    bool stdio;
 } DataCycleArgs;
 
-static void datacycle(void *param)
+// Mapped packages hand out pointers into the mapping. Otherwise the chunk is
+// copied into the package's region with a positional read, so workers never
+// share a file position.
+static unsigned char *ReadChunk(DataCycleArgs *args, int i, IndexEntry entry)
 {
-    DataCycleArgs *args = param;
-    IndexEntry *entries = args->entries;
-    int i = args->i;
-    FILE *f = args->f;
-    Package pkg = *args->pkg;
+    MappedFile mapping = args->pkg->mapping;
+
+    if (IsFileMapped(mapping))
+    {
+        if ((size_t)entry.chunkOffset + entry.diskSize > mapping.size)
+        {
+            TRACELOG(LOG_ERROR, "Entry %d lies outside of the file.\n", i);
+            return NULL;
+        }
+
+        return mapping.data + entry.chunkOffset;
+    }
 
-    IndexEntry entry = entries[i];
+    unsigned char *data = args->chunks + args->chunkCopies[i];
 
-    TRACELOG(LOG_DEBUG, "\nEntry %d:\n", i);
+    if (!args->stdio)
+    {
+        if (pread_file(args->f, data, entry.diskSize, entry.chunkOffset) != entry.diskSize)
+        {
+            TRACELOG(LOG_ERROR, "Entry %d lies outside of the file.\n", i);
+            return NULL;
+        }
+
+        return data;
+    }
 
     TRACELOG(LOG_DEBUG, "Locking fmutex.\n");
     pthread_mutex_lock(args->fmutex);
 
-    if (fseek(f, entry.chunkOffset, SEEK_SET) == -1)
+    if (fseek(args->f, entry.chunkOffset, SEEK_SET) == -1)
     {
         perror("Unexpected error occurred");
     }
 
-    unsigned char *data = malloc(entry.diskSize);
-    fread(data, 1, entry.diskSize, f);
+    fread(data, 1, entry.diskSize, args->f);
 
-    if (feof(f))
+    if (feof(args->f))
     {
         TRACELOG(LOG_ERROR, "Unexpected end of file.\n");
     }
@@ -367,57 +291,208 @@ static void datacycle(void *param)
     TRACELOG(LOG_DEBUG, "Unlocking fmutex.\n");
     pthread_mutex_unlock(args->fmutex);
 
+    return data;
+}
+
+// Points a stub at its on-disk chunk. Compressed entries keep the chunk in
+// dataCompressed and only learn their raw size here; dataRaw is filled on decode.
+void SetPackageEntryChunk(PackageEntry *pkgEntry, IndexEntry entry, unsigned char *chunk)
+{
+    pkgEntry->compressed = entry.isCompressed;
+
     if (entry.isCompressed)
     {
-        pkg.entries[i].compressed = true;
-        unsigned char *uncompressed = DecompressDBPF(data, entry.diskSize, entry.memSize);
-        if (uncompressed)
+        pkgEntry->dataCompressed = chunk;
+        pkgEntry->dataCompressedSize = entry.diskSize;
+        pkgEntry->dataRawSize = entry.memSize;
+    }
+    else
+    {
+        pkgEntry->dataRaw = chunk;
+        pkgEntry->dataRawSize = entry.diskSize;
+    }
+}
+
+static void DecodeEntryData(PackageEntry *pkgEntry)
+{
+    // dataRaw is already set when the caller decompressed into its own buffer.
+    if (pkgEntry->compressed && !pkgEntry->dataRaw)
+    {
+        unsigned char *dataRaw = ArenaAlloc(&pkgEntry->arena, pkgEntry->dataRawSize);
+        if (!DecompressDBPFInto(pkgEntry->dataCompressed, pkgEntry->dataCompressedSize, dataRaw, pkgEntry->dataRawSize))
         {
-            int toPrint = 10;
-            pkg.entries[i].dataRaw = uncompressed;
-            pkg.entries[i].dataRawSize = entry.memSize;
-            
-            if (!ProcessPackageData(uncompressed, entry.memSize, entry.type, &(pkg.entries[i])))
-            {
-                if (writeCorrupted) ExportPackageEntry(pkg.entries[i], TextFormat("corrupted/%#X-%#X-%#X.%s", entry.type, entry.group, entry.instance, GetExtensionFromType(entry.type)));
-                pkg.entries[i].corrupted = true;
-            }
+            pkgEntry->corrupted = true;
+            return;
+        }
+        pkgEntry->dataRaw = dataRaw;
+    }
 
-            for (int i = 0; i < toPrint; i++)
-            {
-                //TRACELOG(LOG_DEBUG, "%#x\n", uncompressed[i]);
-            }
+    if (!ProcessPackageData(pkgEntry->dataRaw, pkgEntry->dataRawSize, pkgEntry->type, pkgEntry))
+    {
+        if (writeCorrupted)
+        {
+            char name[NAMEDICT_MAX_NAME + 32];
+            GetPackageEntryFileName(*pkgEntry, name, sizeof(name));
+            ExportPackageEntry(*pkgEntry, TextFormat("corrupted/%#X-%#X-%s", pkgEntry->type, pkgEntry->group, name));
         }
-        pkg.entries[i].dataCompressed = data;
-        pkg.entries[i].dataCompressedSize = entry.diskSize;
+        pkgEntry->corrupted = true;
     }
-    else
+}
+
+void DecodePackageEntry(PackageEntry *pkgEntry)
+{
+    if (!pkgEntry->compressed || pkgEntry->dataRaw || !IsPackageDedupEnabled())
     {
-        int toPrint = 10;
-        pkg.entries[i].dataRaw = data;
-        pkg.entries[i].dataRawSize = entry.diskSize;
+        DecodeEntryData(pkgEntry);
+        return;
+    }
+
+    bool decode;
+    PackageEntry *shared = AcquireSharedEntry(pkgEntry, &decode);
 
-        if (!ProcessPackageData(data, entry.diskSize, entry.type, &(pkg.entries[i])))
+    if (decode)
+    {
+        DecodeEntryData(shared);
+        PublishSharedEntry(shared);
+    }
+
+    pkgEntry->shared = shared;
+    pkgEntry->dataRaw = shared->dataRaw;
+    pkgEntry->data = shared->data;
+    pkgEntry->corrupted = shared->corrupted;
+}
+
+static void datacycle(int begin, int end, void *ctx)
+{
+    DataCycleArgs *args = ctx;
+    IndexEntry *entries = args->entries;
+    Package pkg = *args->pkg;
+
+    for (int j = begin; j < end; j++)
+    {
+        int i = args->order[j];
+        IndexEntry entry = entries[i];
+
+        TRACELOG(LOG_DEBUG, "\nEntry %d:\n", i);
+
+        unsigned char *data = ReadChunk(args, i, entry);
+
+        if (!data)
         {
-            if (writeCorrupted) ExportPackageEntry(pkg.entries[i], TextFormat("corrupted/%#X-%#X-%#X.%s", entry.type, entry.group, entry.instance, GetExtensionFromType(entry.type)));
             pkg.entries[i].corrupted = true;
+            pkg.entries[i].loadState = PKGENTRY_LOADED;
+            continue;
         }
 
-        for (int i = 0; i < toPrint; i++)
-        {
-            //TRACELOG(LOG_DEBUG, "%#x\n", data[i]);
-        }
+        SetPackageEntryChunk(&pkg.entries[i], entry, data);
+        DecodePackageEntry(&pkg.entries[i]);
+        pkg.entries[i].loadState = PKGENTRY_LOADED;
     }
 }
 
+typedef struct ChunkOrder {
+    uint32_t chunkOffset;
+    int entry;
+} ChunkOrder;
+
+static int compar_chunkorder(const void *p1, const void *p2)
+{
+    const ChunkOrder *a = p1;
+    const ChunkOrder *b = p2;
+
+    if (a->chunkOffset != b->chunkOffset) return a->chunkOffset < b->chunkOffset ? -1 : 1;
+    return a->entry - b->entry;
+}
+
+int *SortByChunkOffset(IndexEntry *entries, int count)
+{
+    ChunkOrder *keys = malloc(sizeof(ChunkOrder) * count);
+    int *order = malloc(sizeof(int) * count);
+
+    for (int i = 0; i < count; i++) keys[i] = (ChunkOrder){ entries[i].chunkOffset, i };
+
+    qsort(keys, count, sizeof(ChunkOrder), compar_chunkorder);
+
+    for (int i = 0; i < count; i++) order[i] = keys[i].entry;
+
+    free(keys);
+    return order;
+}
+
+// One condition variable for every entry: waiting on an entry someone else
+// decodes is rare, so the odd spurious wakeup beats one per entry.
+static pthread_mutex_t entryLoadMutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t entryLoaded = PTHREAD_COND_INITIALIZER;
+static int entryLoadWaiters;
+
+void PublishPackageEntryData(PackageEntry *pkgEntry)
+{
+    __atomic_store_n(&pkgEntry->loadState, PKGENTRY_LOADED, __ATOMIC_SEQ_CST);
+
+    // Paired with the increment in WaitForPackageEntryData, so a waiter
+    // either sees the entry loaded or gets woken.
+    if (__atomic_load_n(&entryLoadWaiters, __ATOMIC_SEQ_CST))
+    {
+        pthread_mutex_lock(&entryLoadMutex);
+        pthread_cond_broadcast(&entryLoaded);
+        pthread_mutex_unlock(&entryLoadMutex);
+    }
+}
+
+void WaitForPackageEntryData(PackageEntry *pkgEntry)
+{
+    if (__atomic_load_n(&pkgEntry->loadState, __ATOMIC_ACQUIRE) == PKGENTRY_LOADED) return;
+
+    pthread_mutex_lock(&entryLoadMutex);
+    __atomic_add_fetch(&entryLoadWaiters, 1, __ATOMIC_SEQ_CST);
+
+    while (__atomic_load_n(&pkgEntry->loadState, __ATOMIC_SEQ_CST) != PKGENTRY_LOADED)
+    {
+        pthread_cond_wait(&entryLoaded, &entryLoadMutex);
+    }
+
+    __atomic_sub_fetch(&entryLoadWaiters, 1, __ATOMIC_SEQ_CST);
+    pthread_mutex_unlock(&entryLoadMutex);
+}
+
+PackageEntry *GetPackageEntryData(Package pkg, int i)
+{
+    PackageEntry *pkgEntry = &pkg.entries[i];
+    unsigned char state = PKGENTRY_UNLOADED;
+
+    if (__atomic_load_n(&pkgEntry->loadState, __ATOMIC_ACQUIRE) == PKGENTRY_LOADED) return pkgEntry;
+
+    if (__atomic_compare_exchange_n(&pkgEntry->loadState, &state, PKGENTRY_LOADING, false, __ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE))
+    {
+        DecodePackageEntry(pkgEntry);
+        PublishPackageEntryData(pkgEntry);
+        return pkgEntry;
+    }
+
+    // Someone else is decoding this entry. Waiting cannot deadlock: a thread
+    // waiting inside the decode only helps with the decode's own subtasks.
+    WaitForPackageEntryData(pkgEntry);
+
+    return pkgEntry;
+}
+
 Package LoadPackageFile(FILE *f)
 {
-    Package pkg = { 0 };
+    return LoadPackageFileEx(f, 0);
+}
+
+Package LoadPackageFileEx(FILE *f, int flags)
+{
+    TaskGroup group = NewTaskGroup(GetCurrentThreadpool());
+
+    return LoadPackageFileInGroup(f, flags, &group);
+}
+
+IndexEntry *ReadPackageIndex(FILE *f, PackageHeader *outHeader)
+{
     PackageHeader header;
     fread(&header, sizeof(PackageHeader), 1, f);
 
-    mkdir("corrupted");
-
     TRACELOG(LOG_DEBUG, "Header:\n");
     TRACELOG(LOG_DEBUG, "Magic: %.4s\n", header.magic);
     TRACELOG(LOG_DEBUG, "Major Version #: %d\n", header.majorVersion);
@@ -458,16 +533,11 @@ Package LoadPackageFile(FILE *f)
         readuint(&indexUnknown, f);
     }
 
-    pkg.entryCount = header.indexEntryCount;
-
     IndexEntry *entries = malloc(sizeof(IndexEntry) * header.indexEntryCount);
 
-    pkg.entries = malloc(sizeof(PackageEntry) * pkg.entryCount);
-
-    for (int i = 0; i < header.indexEntryCount; i++)
+    for (unsigned int i = 0; i < header.indexEntryCount; i++)
     {
         IndexEntry entry = { 0 };
-        PackageEntry pkgEntry = { 0 };
 
         if ((index.indexType & (1 << 0)) == 1 << 0)
         {
@@ -522,174 +592,316 @@ Package LoadPackageFile(FILE *f)
         TRACELOG(LOG_DEBUG, "Mem Size: %u\n", entry.memSize);
         TRACELOG(LOG_DEBUG, "Compressed? %s\n", entry.isCompressed?"yes":"no");
 
-        pkgEntry.type = entry.type;
-        pkgEntry.group = entry.group;
-        pkgEntry.instance = entry.instance;
-
         entries[i] = entry;
-        pkg.entries[i] = pkgEntry;
+    }
+
+    *outHeader = header;
+    return entries;
+}
+
+Package LoadPackageFileInGroup(FILE *f, int flags, TaskGroup *group)
+{
+    Package pkg = { 0 };
+    PackageHeader header;
+
+    mkdir("corrupted");
+
+    IndexEntry *entries = ReadPackageIndex(f, &header);
+
+    pkg.entryCount = header.indexEntryCount;
+    pkg.entries = malloc(sizeof(PackageEntry) * pkg.entryCount);
+
+    for (unsigned int i = 0; i < header.indexEntryCount; i++)
+    {
+        pkg.entries[i] = (PackageEntry){ 0 };
+        pkg.entries[i].type = entries[i].type;
+        pkg.entries[i].group = entries[i].group;
+        pkg.entries[i].instance = entries[i].instance;
+        pkg.entries[i].compressed = entries[i].isCompressed;
+        pkg.entries[i].chunkOffset = entries[i].chunkOffset;
     }
 
     TRACELOG(LOG_DEBUG, "\nData Cycle.\n");
 
-    InitThreadpool(-1);
+    if (flags & (PKGLOAD_MMAP | PKGLOAD_LAZY))
+    {
+        pkg.mapping = MapFile(f);
+        if (!IsFileMapped(pkg.mapping))
+        {
+            TRACELOG(LOG_WARNING, "Unable to map package, falling back to reading it.\n");
+        }
+    }
+
+    if ((flags & PKGLOAD_LAZY) && IsFileMapped(pkg.mapping))
+    {
+        for (unsigned int i = 0; i < header.indexEntryCount; i++)
+        {
+            if ((size_t)entries[i].chunkOffset + entries[i].diskSize > pkg.mapping.size)
+            {
+                TRACELOG(LOG_ERROR, "Entry %d lies outside of the file.\n", i);
+                SetPackageEntryChunk(&pkg.entries[i], entries[i], NULL);
+                pkg.entries[i].corrupted = true;
+                pkg.entries[i].loadState = PKGENTRY_LOADED;
+                continue;
+            }
+
+            SetPackageEntryChunk(&pkg.entries[i], entries[i], pkg.mapping.data + entries[i].chunkOffset);
+        }
+
+        free(entries);
+
+        pkg.index = BuildPackageIndex(pkg.entries, pkg.entryCount);
+
+        return pkg;
+    }
+
     pthread_mutex_t fmutex;
     pthread_mutex_init(&fmutex, NULL);
 
-    DataCycleArgs *argList = malloc(sizeof(DataCycleArgs) * header.indexEntryCount);
+    DataCycleArgs args = { 0 };
+    args.f = f;
+    args.order = SortByChunkOffset(entries, header.indexEntryCount);
+    args.pkg = &pkg;
+    args.entries = entries;
+    args.fmutex = &fmutex;
+    args.stdio = flags & PKGLOAD_STDIO;
 
-    for (int i = 0; i < header.indexEntryCount; i++)
+    // All chunk copies share one allocation owned by the package.
+    if (!IsFileMapped(pkg.mapping))
     {
-        DataCycleArgs args;
-        args.f = f;
-        args.i = i;
-        args.pkg = &pkg;
-        args.entries = entries;
-        args.fmutex = &fmutex;
-        argList[i] = args;
-        NewThreadpoolTask(datacycle, &argList[i]);
+        size_t total = 0;
+
+        args.chunkCopies = malloc(sizeof(size_t) * header.indexEntryCount);
+        for (unsigned int j = 0; j < header.indexEntryCount; j++)
+        {
+            args.chunkCopies[args.order[j]] = total;
+            total += entries[args.order[j]].diskSize;
+        }
+
+        args.chunks = ArenaAlloc(&pkg.arena, total);
     }
 
-    WaitForThreadpoolTasksDone();
-    CloseThreadpool();
+    // Workers claim runs of entries as they go, so scheduling costs a few
+    // atomics per run instead of a queued task per entry.
+    TaskRange range;
+    NewTaskGroupRange(group, &range, 0, header.indexEntryCount, 1, datacycle, &args);
+
+    WaitForTaskGroup(group);
     pthread_mutex_destroy(&fmutex);
 
+    // Entries that were never claimed because the load was cancelled.
+    for (int i = range.next; i < (int)header.indexEntryCount; i++)
+    {
+        pkg.entries[args.order[i]].corrupted = true;
+        pkg.entries[args.order[i]].loadState = PKGENTRY_LOADED;
+    }
+
+    free(args.order);
+    free(args.chunkCopies);
+
     free(entries);
 
+    pkg.index = BuildPackageIndex(pkg.entries, pkg.entryCount);
+
     return pkg;
 }
 
 void UnloadPackageFile(Package pkg)
 {
+    for (unsigned int i = 0; i < pkg.entryCount; i++)
+    {
+        UnloadPackageEntryData(&pkg.entries[i]);
+        if (pkg.entries[i].ownsDataRaw) free(pkg.entries[i].dataRaw);
+    }
+
+    UnloadArena(&pkg.arena);
     free(pkg.entries);
+    FreePackageIndex(pkg.index);
+    UnmapFile(pkg.mapping);
 }
 
-void ExportPackageEntry(PackageEntry entry, const char *filename)
+// Textures are uploaded per entry, even when the images are shared.
+static void UnloadEntryTextures(PackageEntry *pkgEntry)
 {
-    switch (entry.type)
+    switch (pkgEntry->type)
     {
-        case PKGENTRY_ER2:
-        case PKGENTRY_HTML:
-        case PKGENTRY_CSS:
-        case PKGENTRY_JSN8:
-        case PKGENTRY_SCPT: // Script file format (?)
-        case PKGENTRY_TEXT: // "textual" file.
-        case PKGENTRY_JSON: // JSON file.
+        case PKGENTRY_RAST:
+        case PKGENTRY_PNG:
+        case PKGENTRY_GIF:
         {
-            SaveFileData(filename, entry.data.scriptSource, strlen(entry.data.scriptSource));
+            if (IsTextureValid(pkgEntry->data.imgData.tex)) UnloadTexture(pkgEntry->data.imgData.tex);
         } break;
-        default: SaveFileData(filename, entry.dataRaw, entry.dataRawSize); break;
+        case PKGENTRY_RW4:
+        {
+            if (pkgEntry->data.rw4Data.type != RW4_TEXTURE) break;
+            if (IsTextureValid(pkgEntry->data.rw4Data.data.texData.tex)) UnloadTexture(pkgEntry->data.rw4Data.data.texData.tex);
+        } break;
+        default: break;
     }
 }
 
-static bool TextStartsWith(const char *t1, const char *startsWith)
-{
-    return strstr(t1, startsWith) == t1;
-}
-
-int *SearchPackage(Package pkg, PackageSearchParams params, int *nResults)
+static void FreeEntryData(PackageEntry *pkgEntry)
 {
-    int *results = NULL;
-
-    *nResults = 0;
+    UnloadEntryTextures(pkgEntry);
 
-    for (int i = 0; i < pkg.entryCount; i++)
+    // Decoders allocate from the entry's arena, except for what raylib loads.
+    if (pkgEntry->shared)
     {
-        bool isCorrect = true;
-        if (params.searchInstance)
-        {
-            if (!TextStartsWith(TextFormat("%#X", pkg.entries[i].instance), params.instance)) isCorrect = false;
-        }
-        if (params.searchGroup)
+        ReleaseSharedEntry(pkgEntry->shared, pkgEntry);
+        pkgEntry->shared = NULL;
+    }
+    else switch (pkgEntry->type)
+    {
+        case PKGENTRY_PNG: UnloadImage(pkgEntry->data.imgData.img); break;
+        case PKGENTRY_GIF: UnloadImage(pkgEntry->data.gifData.img); break;
+        case PKGENTRY_BNK:
         {
-            if (!TextStartsWith(TextFormat("%#X", pkg.entries[i].group), params.group)) isCorrect = false;
-        }
-        if (params.searchType)
+            for (int i = 0; i < pkgEntry->data.bnkData.waveCount && pkgEntry->data.bnkData.waves; i++)
+            {
+                UnloadWave(pkgEntry->data.bnkData.waves[i]);
+            }
+        } break;
+        case PKGENTRY_RW4:
         {
-            if (!TextStartsWith(TextFormat("%#X", pkg.entries[i].type), params.type)) isCorrect = false;
-        }
-        if (!isCorrect) continue;
-
-        (*nResults)++;
-        results = realloc(results, sizeof(int) * (*nResults));
-        results[(*nResults) - 1] = i;
+            if (pkgEntry->data.rw4Data.type == RW4_TEXTURE) UnloadImage(pkgEntry->data.rw4Data.data.texData.img);
+        } break;
+        default: break;
     }
 
-    return results;
+    UnloadArena(&pkgEntry->arena);
+    memset(&pkgEntry->data, 0, sizeof(pkgEntry->data));
+
+    // Compressed entries decompressed into the arena.
+    if (pkgEntry->compressed) pkgEntry->dataRaw = NULL;
 }
 
-void MergePackages(Package *dest, Package src)
+void UnloadPackageEntryData(PackageEntry *pkgEntry)
 {
-    int startIndex = dest->entryCount;
+    if (__atomic_load_n(&pkgEntry->loadState, __ATOMIC_ACQUIRE) != PKGENTRY_LOADED) return;
 
-    dest->entryCount += src.entryCount;
-    dest->entries = realloc(dest->entries, dest->entryCount * sizeof(PackageEntry));
+    FreeEntryData(pkgEntry);
 
-    memcpy(dest->entries + startIndex, src.entries, src.entryCount * sizeof(PackageEntry));
+    // Entries without a chunk (outside of the file, cancelled) stay corrupted.
+    if (pkgEntry->compressed ? pkgEntry->dataCompressed : pkgEntry->dataRaw)
+    {
+        pkgEntry->corrupted = false;
+        pkgEntry->loadState = PKGENTRY_UNLOADED;
+    }
 }
 
-void SetWriteCorruptedPackageEntries(bool val)
+void ReplacePackageEntryData(Package pkg, int i, const unsigned char *data, int size)
 {
-    writeCorrupted = val;
-}
+    PackageEntry *pkgEntry = GetPackageEntryData(pkg, i);
 
-void ExportPackage(Package pkg, const char *filename)
-{
-    FILE *f = fopen(filename, "wb");
+    // Loading again, so GetPackageEntryData waits instead of decoding the old chunk.
+    __atomic_store_n(&pkgEntry->loadState, PKGENTRY_LOADING, __ATOMIC_RELEASE);
 
-    PackageHeader header = { .magic = "DBPF" };
-    header.majorVersion = 3;
-    header.minorVersion = 0;
-    header.indexEntryCount = pkg.entryCount;
-    header.indexMajorVersion = 0;
-    header.indexMinorVersion = 3;
+    FreeEntryData(pkgEntry);
 
-    IndexEntry *indexEntries = malloc(sizeof(IndexEntry) * pkg.entryCount);
+    // Not from the entry's arena, which evictions reset: the entry is decoded
+    // again from this copy. Only the next replace or UnloadPackageFile frees it.
+    if (pkgEntry->ownsDataRaw) free(pkgEntry->dataRaw);
 
-    // TODO check if all entries have same group or type
+    unsigned char *dataRaw = malloc(size);
+    memcpy(dataRaw, data, size);
 
-    MemStream dataStream = { 0 };
+    pkgEntry->compressed = false;
+    pkgEntry->dataCompressed = NULL;
+    pkgEntry->dataCompressedSize = 0;
+    pkgEntry->dataRaw = dataRaw;
+    pkgEntry->dataRawSize = size;
+    pkgEntry->ownsDataRaw = true;
+    pkgEntry->corrupted = false;
 
-    for (int i = 0; i < pkg.entryCount; i++)
-    {
-        indexEntries[i].type = pkg.entries[i].type;
-        indexEntries[i].group = pkg.entries[i].group;
-        indexEntries[i].instance = pkg.entries[i].instance;
-        indexEntries[i].chunkOffset = dataStream.size + sizeof(PackageHeader);
+    DecodeEntryData(pkgEntry);
+    PublishPackageEntryData(pkgEntry);
+}
+
+static size_t GetImageDataSize(Image img, int frames)
+{
+    return IsImageValid(img) ? (size_t)GetPixelDataSize(img.width, img.height, img.format) * frames : 0;
+}
+
+static size_t GetTextureDataSize(Texture2D tex)
+{
+    return IsTextureValid(tex) ? GetPixelDataSize(tex.width, tex.height, tex.format) : 0;
+}
 
-        // TODO: compress data
-        memstream_write(&dataStream, pkg.entries[i].dataRaw, pkg.entries[i].dataRawSize);
-        indexEntries[i].diskSize = pkg.entries[i].dataRawSize; // TODO bitwise OR with 0x80000000?
-        indexEntries[i].memSize = pkg.entries[i].dataRawSize;
-        indexEntries[i].compressed = 0x0000;
-        indexEntries[i].unknown = 0x0000;
+static size_t GetEntryTexturesSize(const PackageEntry *pkgEntry)
+{
+    switch (pkgEntry->type)
+    {
+        case PKGENTRY_RAST:
+        case PKGENTRY_PNG:
+        case PKGENTRY_GIF: return GetTextureDataSize(pkgEntry->data.imgData.tex);
+        case PKGENTRY_RW4:
+        {
+            if (pkgEntry->data.rw4Data.type != RW4_TEXTURE) return 0;
+            return GetTextureDataSize(pkgEntry->data.rw4Data.data.texData.tex);
+        }
+        default: return 0;
     }
+}
 
-    header.indexOffset = dataStream.size + sizeof(PackageHeader);
+// Everything but the textures.
+static size_t GetEntryDecodedSize(const PackageEntry *pkgEntry)
+{
+    size_t size = pkgEntry->arena.reserved;
 
-    MemStream indexStream = { 0 };
+    switch (pkgEntry->type)
+    {
+        case PKGENTRY_PNG: size += GetImageDataSize(pkgEntry->data.imgData.img, 1); break;
+        case PKGENTRY_GIF: size += GetImageDataSize(pkgEntry->data.gifData.img, pkgEntry->data.gifData.frameCount); break;
+        case PKGENTRY_BNK:
+        {
+            for (int i = 0; i < pkgEntry->data.bnkData.waveCount && pkgEntry->data.bnkData.waves; i++)
+            {
+                Wave wave = pkgEntry->data.bnkData.waves[i];
+                size += (size_t)wave.frameCount * wave.channels * wave.sampleSize / 8;
+            }
+        } break;
+        case PKGENTRY_RW4:
+        {
+            if (pkgEntry->data.rw4Data.type == RW4_TEXTURE) size += GetImageDataSize(pkgEntry->data.rw4Data.data.texData.img, 1);
+        } break;
+        default: break;
+    }
 
-    uint32_t indexType = 0;
-    memstream_write(&indexStream, &indexType, sizeof(uint32_t));
+    return size;
+}
+
+size_t GetPackageEntryDataSize(const PackageEntry *pkgEntry)
+{
+    if (__atomic_load_n(&pkgEntry->loadState, __ATOMIC_ACQUIRE) != PKGENTRY_LOADED) return pkgEntry->arena.reserved;
 
-    for (int i = 0; i < pkg.entryCount; i++)
+    // Shared data is split evenly, so the sizes of all entries add up to what is held.
+    if (pkgEntry->shared)
     {
-        memstream_write(&indexStream, &indexEntries[i].type, 4);
-        memstream_write(&indexStream, &indexEntries[i].group, 4);
-        uint32_t unk = 0;
-        memstream_write(&indexStream, &unk, 4);
-        memstream_write(&indexStream, &indexEntries[i].instance, 4);
-        memstream_write(&indexStream, &indexEntries[i].chunkOffset, 4);
-        memstream_write(&indexStream, &indexEntries[i].diskSize, 4);
-        memstream_write(&indexStream, &indexEntries[i].memSize, 4);
-        memstream_write(&indexStream, &indexEntries[i].compressed, 2);
-        memstream_write(&indexStream, &indexEntries[i].unknown, 2);
+        return GetEntryTexturesSize(pkgEntry) + GetEntryDecodedSize(pkgEntry->shared) / GetSharedEntryRefCount(pkgEntry->shared);
     }
 
-    header.indexSize = indexStream.size;
+    return GetEntryTexturesSize(pkgEntry) + GetEntryDecodedSize(pkgEntry);
+}
 
-    fwrite(&header, sizeof(PackageHeader), 1, f);
-    fwrite(dataStream.buf, 1, dataStream.size, f);
-    fwrite(indexStream.buf, 1, indexStream.size, f);
+void ExportPackageEntry(PackageEntry entry, const char *filename)
+{
+    switch (entry.type)
+    {
+        case PKGENTRY_ER2:
+        case PKGENTRY_HTML:
+        case PKGENTRY_CSS:
+        case PKGENTRY_JSN8:
+        case PKGENTRY_SCPT: // Script file format (?)
+        case PKGENTRY_TEXT: // "textual" file.
+        case PKGENTRY_JSON: // JSON file.
+        {
+            SaveFileData(filename, entry.data.scriptSource, strlen(entry.data.scriptSource));
+        } break;
+        default: SaveFileData(filename, entry.dataRaw, entry.dataRawSize); break;
+    }
+}
 
+void SetWriteCorruptedPackageEntries(bool val)
+{
+    writeCorrupted = val;
 }
@@ -0,0 +1,416 @@
+#include "filetypes/pkgcache.h"
+#include "filetypes/pkgindex.h"
+#include "hash.h"
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <cpl_raylib.h>
+
+#define PACKAGE_CACHE_VERSION 2
+
+static bool StatPackage(const char *path, uint64_t *size, int64_t *mtime)
+{
+    struct stat st;
+
+    if (stat(path, &st) == -1) return false;
+
+    *size = st.st_size;
+
+    // A rewrite of the same size within the same second would pass a check
+    // on whole seconds.
+#if defined(__APPLE__)
+    *mtime = (int64_t)st.st_mtimespec.tv_sec * 1000000000 + st.st_mtimespec.tv_nsec;
+#elif defined(_WIN32)
+    *mtime = st.st_mtime;
+#else
+    *mtime = (int64_t)st.st_mtim.tv_sec * 1000000000 + st.st_mtim.tv_nsec;
+#endif
+    return true;
+}
+
+static unsigned int PathSlotOf(const char *path, uint32_t pathSlotCount)
+{
+    return (unsigned int)HashData64(path, strlen(path)) & (pathSlotCount - 1);
+}
+
+static const char *GetCachedPath(PackageCache cache, int cached)
+{
+    const PackageCacheFile *file = &cache.files[cached];
+
+    if (file->pathOffset >= cache.header->stringsSize) return "";
+    return cache.strings + file->pathOffset;
+}
+
+PackageCache LoadPackageCache(const char *filename)
+{
+    PackageCache cache = { 0 };
+    MappedFile mapping = MapFileFromPath(filename);
+
+    if (!IsFileMapped(mapping)) return cache;
+
+    const PackageCacheHeader *header = (const PackageCacheHeader *)mapping.data;
+    size_t expected = sizeof(PackageCacheHeader);
+
+    if (mapping.size >= expected)
+    {
+        expected += (size_t)header->packageCount * sizeof(PackageCacheFile);
+        expected += (size_t)header->pathSlotCount * sizeof(int32_t);
+        expected += (size_t)header->entryCount * sizeof(PackageCacheEntry);
+        expected += (size_t)header->resourceCount * sizeof(ResourceSlot);
+        expected += (size_t)header->indexSize * sizeof(int32_t);
+        expected += header->stringsSize;
+    }
+
+    if (mapping.size < sizeof(PackageCacheHeader) || memcmp(header->magic, "OSCI", 4) || header->version != PACKAGE_CACHE_VERSION || mapping.size != expected ||
+        !header->pathSlotCount || (header->pathSlotCount & (header->pathSlotCount - 1)) || header->pathSlotCount <= header->packageCount)
+    {
+        TRACELOG(LOG_WARNING, "%s: not a valid package cache, ignoring it.\n", filename);
+        UnmapFile(mapping);
+        return cache;
+    }
+
+    cache.mapping = mapping;
+    cache.header = header;
+    cache.files = (const PackageCacheFile *)(header + 1);
+    cache.pathSlots = (const int32_t *)(cache.files + header->packageCount);
+    cache.entries = (const PackageCacheEntry *)(cache.pathSlots + header->pathSlotCount);
+    cache.resources = (const ResourceSlot *)(cache.entries + header->entryCount);
+    cache.index = (const int32_t *)(cache.resources + header->resourceCount);
+    cache.strings = (const char *)(cache.index + header->indexSize);
+
+    return cache;
+}
+
+void UnloadPackageCache(PackageCache cache)
+{
+    UnmapFile(cache.mapping);
+}
+
+// Size and mtime only; the entries and tables are checked as they are used.
+static bool IsCachedPackageFresh(PackageCache cache, int cached, const char *path)
+{
+    const PackageCacheFile *file = &cache.files[cached];
+    uint64_t size;
+    int64_t mtime;
+
+    if (!StatPackage(path, &size, &mtime)) return false;
+
+    return file->size == size && file->mtime == mtime &&
+           (uint64_t)file->firstEntry + file->entryCount <= cache.header->entryCount;
+}
+
+int FindCachedPackage(PackageCache cache, const char *path)
+{
+    if (!cache.header) return -1;
+
+    uint32_t mask = cache.header->pathSlotCount - 1;
+
+    for (uint32_t s = PathSlotOf(path, cache.header->pathSlotCount), probes = 0; probes <= mask; s = (s + 1) & mask, probes++)
+    {
+        int32_t cached = cache.pathSlots[s];
+
+        if (cached == -1) return -1;
+        if (cached < 0 || (uint32_t)cached >= cache.header->packageCount) return -1;
+        if (strcmp(GetCachedPath(cache, cached), path)) continue;
+
+        return IsCachedPackageFresh(cache, cached, path) ? cached : -1;
+    }
+
+    return -1;
+}
+
+bool IsPackageCacheCurrent(PackageCache cache, const char **paths, int count)
+{
+    if (!cache.header || cache.header->packageCount != (uint32_t)count) return false;
+
+    for (int i = 0; i < count; i++)
+    {
+        if (strcmp(GetCachedPath(cache, i), paths[i]) || !IsCachedPackageFresh(cache, i, paths[i])) return false;
+    }
+
+    return true;
+}
+
+static PackageIndex *LoadCachedPackageIndex(PackageCache cache, const PackageCacheFile *file)
+{
+    uint64_t size = (uint64_t)file->slotCount + 2 * (uint64_t)file->entryCount;
+
+    if ((uint64_t)file->indexOffset + size > cache.header->indexSize) return NULL;
+
+    const int32_t *slots = cache.index + file->indexOffset;
+
+    return LoadPackageIndex(file->entryCount, file->slotCount, slots, slots + file->slotCount, slots + file->slotCount + file->entryCount);
+}
+
+Package LoadCachedPackage(PackageCache cache, int cached, const char *path)
+{
+    Package pkg = { 0 };
+    const PackageCacheFile *file = &cache.files[cached];
+
+    pkg.mapping = MapFileFromPath(path);
+    if (!IsFileMapped(pkg.mapping)) return pkg;
+
+    pkg.entryCount = file->entryCount;
+    pkg.entries = calloc(pkg.entryCount, sizeof(PackageEntry));
+
+    for (unsigned int i = 0; i < pkg.entryCount; i++)
+    {
+        const PackageCacheEntry *cacheEntry = &cache.entries[file->firstEntry + i];
+        PackageEntry *pkgEntry = &pkg.entries[i];
+
+        pkgEntry->type = cacheEntry->type;
+        pkgEntry->group = cacheEntry->group;
+        pkgEntry->instance = cacheEntry->instance;
+        pkgEntry->chunkOffset = cacheEntry->chunkOffset;
+        pkgEntry->compressed = cacheEntry->compressed;
+
+        if ((size_t)cacheEntry->chunkOffset + cacheEntry->diskSize > pkg.mapping.size)
+        {
+            pkgEntry->corrupted = true;
+            pkgEntry->loadState = PKGENTRY_LOADED;
+            continue;
+        }
+
+        unsigned char *chunk = pkg.mapping.data + cacheEntry->chunkOffset;
+
+        if (pkgEntry->compressed)
+        {
+            pkgEntry->dataCompressed = chunk;
+            pkgEntry->dataCompressedSize = cacheEntry->diskSize;
+        }
+        else
+        {
+            pkgEntry->dataRaw = chunk;
+        }
+        pkgEntry->dataRawSize = cacheEntry->memSize;
+    }
+
+    pkg.index = LoadCachedPackageIndex(cache, file);
+    if (!pkg.index) pkg.index = BuildPackageIndex(pkg.entries, pkg.entryCount);
+
+    return pkg;
+}
+
+// The merged table is searched without further checks, so it has to be sorted
+// and point at entries that exist.
+static bool IsResourceTableValid(PackageCache cache)
+{
+    for (uint32_t i = 0; i < cache.header->resourceCount; i++)
+    {
+        const ResourceSlot *slot = &cache.resources[i];
+
+        if (slot->layer < 0 || (uint32_t)slot->layer >= cache.header->packageCount) return false;
+        if (slot->entry < 0 || (uint32_t)slot->entry >= cache.files[slot->layer].entryCount) return false;
+
+        if (i == 0) continue;
+
+        const ResourceSlot *prev = slot - 1;
+
+        if (prev->type != slot->type ? prev->type > slot->type :
+            prev->group != slot->group ? prev->group > slot->group :
+            prev->instance >= slot->instance) return false;
+    }
+
+    return true;
+}
+
+bool LoadCachedResources(ResourceManager *mgr, PackageCache *cache)
+{
+    if (!cache->header || !IsResourceTableValid(*cache)) return false;
+
+    int count = cache->header->packageCount;
+    Package *pkgs = malloc(sizeof(Package) * count);
+    const char **names = malloc(sizeof(char *) * count);
+    bool ok = true;
+
+    for (int i = 0; i < count && ok; i++)
+    {
+        names[i] = GetCachedPath(*cache, i);
+        pkgs[i] = LoadCachedPackage(*cache, i, names[i]);
+        ok = IsFileMapped(pkgs[i].mapping);
+
+        if (!ok)
+        {
+            for (int j = 0; j < i; j++) UnloadPackageFile(pkgs[j]);
+        }
+    }
+
+    if (ok)
+    {
+        AddResolvedResourceLayers(mgr, pkgs, names, count, cache->resources, cache->header->resourceCount, cache->mapping);
+        *cache = (PackageCache){ 0 };
+    }
+
+    free(names);
+    free(pkgs);
+
+    return ok;
+}
+
+static int compar_resourceslot(const void *p1, const void *p2)
+{
+    const ResourceSlot *a = p1;
+    const ResourceSlot *b = p2;
+
+    if (a->type != b->type) return a->type < b->type ? -1 : 1;
+    if (a->group != b->group) return a->group < b->group ? -1 : 1;
+    if (a->instance != b->instance) return a->instance < b->instance ? -1 : 1;
+    if (a->layer != b->layer) return a->layer - b->layer;
+    return a->entry - b->entry;
+}
+
+// Resolves every key like a resource manager with one layer per package
+// would: the last package that has it wins, and within it the last entry.
+static ResourceSlot *MergeResources(const Package *pkgs, const int *saved, int savedCount, uint32_t entryCount, uint32_t *resourceCount)
+{
+    ResourceSlot *slots = malloc(sizeof(ResourceSlot) * (entryCount ? entryCount : 1));
+    uint32_t count = 0;
+
+    for (int k = 0; k < savedCount; k++)
+    {
+        const Package *pkg = &pkgs[saved[k]];
+
+        for (unsigned int j = 0; j < pkg->entryCount; j++)
+        {
+            const PackageEntry *entry = &pkg->entries[j];
+            slots[count++] = (ResourceSlot){ entry->type, entry->group, entry->instance, k, (int)j };
+        }
+    }
+
+    qsort(slots, count, sizeof(ResourceSlot), compar_resourceslot);
+
+    uint32_t out = 0;
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        bool last = i + 1 == count || slots[i + 1].type != slots[i].type ||
+                    slots[i + 1].group != slots[i].group || slots[i + 1].instance != slots[i].instance;
+
+        if (last) slots[out++] = slots[i];
+    }
+
+    *resourceCount = out;
+    return slots;
+}
+
+bool SavePackageCache(const char *filename, const char **paths, const Package *pkgs, int count)
+{
+    PackageCacheHeader header = { .magic = "OSCI", .version = PACKAGE_CACHE_VERSION };
+    PackageCacheFile *files = calloc(count, sizeof(PackageCacheFile));
+    int *saved = malloc(sizeof(int) * count);
+    int savedCount = 0;
+
+    // A package that cannot be stated would be cached with a size and mtime
+    // that never match, or worse, match by accident. Leave it out.
+    for (int i = 0; i < count; i++)
+    {
+        PackageCacheFile *file = &files[savedCount];
+        const PackageIndex *index = pkgs[i].index;
+
+        if (!StatPackage(paths[i], &file->size, &file->mtime))
+        {
+            TRACELOG(LOG_WARNING, "Could not stat %s, leaving it out of the index cache.\n", paths[i]);
+            continue;
+        }
+
+        file->pathOffset = header.stringsSize;
+        file->firstEntry = header.entryCount;
+        file->entryCount = pkgs[i].entryCount;
+        file->indexOffset = header.indexSize;
+        file->slotCount = index && index->entryCount == pkgs[i].entryCount ? index->slotCount : 0;
+
+        header.stringsSize += strlen(paths[i]) + 1;
+        header.entryCount += pkgs[i].entryCount;
+        header.indexSize += file->slotCount ? file->slotCount + 2 * file->entryCount : 0;
+        saved[savedCount++] = i;
+    }
+
+    header.packageCount = savedCount;
+    header.pathSlotCount = 16;
+    while (header.pathSlotCount < (uint32_t)savedCount * 2) header.pathSlotCount <<= 1;
+
+    int32_t *pathSlots = malloc(sizeof(int32_t) * header.pathSlotCount);
+
+    for (uint32_t s = 0; s < header.pathSlotCount; s++) pathSlots[s] = -1;
+
+    // A path given twice is found at its first position.
+    for (int k = 0; k < savedCount; k++)
+    {
+        uint32_t s = PathSlotOf(paths[saved[k]], header.pathSlotCount);
+
+        while (pathSlots[s] != -1) s = (s + 1) & (header.pathSlotCount - 1);
+        pathSlots[s] = k;
+    }
+
+    ResourceSlot *resources = MergeResources(pkgs, saved, savedCount, header.entryCount, &header.resourceCount);
+
+    FILE *f = fopen(filename, "wb");
+
+    if (!f)
+    {
+        perror(filename);
+        free(resources);
+        free(pathSlots);
+        free(saved);
+        free(files);
+        return false;
+    }
+
+    fwrite(&header, sizeof(header), 1, f);
+    fwrite(files, sizeof(PackageCacheFile), savedCount, f);
+    fwrite(pathSlots, sizeof(int32_t), header.pathSlotCount, f);
+
+    for (int k = 0; k < savedCount; k++)
+    {
+        const Package *pkg = &pkgs[saved[k]];
+        PackageCacheEntry *entries = malloc(sizeof(PackageCacheEntry) * pkg->entryCount);
+
+        for (unsigned int j = 0; j < pkg->entryCount; j++)
+        {
+            PackageEntry pkgEntry = pkg->entries[j];
+
+            entries[j] = (PackageCacheEntry){
+                .type = pkgEntry.type,
+                .group = pkgEntry.group,
+                .instance = pkgEntry.instance,
+                .chunkOffset = pkgEntry.chunkOffset,
+                .diskSize = pkgEntry.compressed ? pkgEntry.dataCompressedSize : pkgEntry.dataRawSize,
+                .memSize = pkgEntry.dataRawSize,
+                .compressed = pkgEntry.compressed,
+            };
+        }
+
+        fwrite(entries, sizeof(PackageCacheEntry), pkg->entryCount, f);
+        free(entries);
+    }
+
+    fwrite(resources, sizeof(ResourceSlot), header.resourceCount, f);
+
+    for (int k = 0; k < savedCount; k++)
+    {
+        const PackageIndex *index = pkgs[saved[k]].index;
+
+        if (!files[k].slotCount) continue;
+
+        fwrite(index->slots, sizeof(int32_t), index->slotCount, f);
+        fwrite(index->byType, sizeof(int32_t), index->entryCount, f);
+        fwrite(index->byGroup, sizeof(int32_t), index->entryCount, f);
+    }
+
+    for (int k = 0; k < savedCount; k++)
+    {
+        fwrite(paths[saved[k]], 1, strlen(paths[saved[k]]) + 1, f);
+    }
+
+    free(resources);
+    free(pathSlots);
+    free(saved);
+    free(files);
+
+    bool ok = !ferror(f);
+    fclose(f);
+
+    TRACELOG(LOG_INFO, "Wrote index cache for %d packages (%u entries, %u resources) to %s.\n", savedCount, header.entryCount, header.resourceCount, filename);
+
+    return ok;
+}
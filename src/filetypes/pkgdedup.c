@@ -0,0 +1,204 @@
+#include "filetypes/pkgdedup.h"
+#include "filetypes/dbpf.h"
+#include "hash.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <cpl_pthread.h>
+
+// entry.dataCompressed is the chunk of the first entry, not a copy. It is
+// only valid while that entry holds its reference, so the shared entry is
+// taken out of the table when that entry lets go; later identical entries
+// start a new one.
+typedef struct SharedEntry {
+    PackageEntry entry;     // First, so a PackageEntry * leads back here.
+    uint64_t hash;
+    int refs;
+    bool linked;            // Still in the table and entry.dataCompressed still valid.
+    struct SharedEntry *next;
+} SharedEntry;
+
+static pthread_mutex_t dedupMutex = PTHREAD_MUTEX_INITIALIZER;
+static bool dedupEnabled;
+
+static SharedEntry **buckets;
+static int bucketCount;     // Always a power of two.
+static PackageDedupStats stats;
+
+static void LockDedup(void)
+{
+    pthread_mutex_lock(&dedupMutex);
+}
+
+static void UnlockDedup(void)
+{
+    pthread_mutex_unlock(&dedupMutex);
+}
+
+static void GrowBuckets(void)
+{
+    int oldCount = bucketCount;
+    SharedEntry **old = buckets;
+
+    bucketCount = bucketCount ? bucketCount * 2 : 256;
+    buckets = calloc(bucketCount, sizeof(SharedEntry *));
+
+    for (int b = 0; b < oldCount; b++)
+    {
+        for (SharedEntry *shared = old[b], *next; shared; shared = next)
+        {
+            next = shared->next;
+            shared->next = buckets[shared->hash & (bucketCount - 1)];
+            buckets[shared->hash & (bucketCount - 1)] = shared;
+        }
+    }
+
+    free(old);
+}
+
+// Called with the lock held, which keeps the first entry's chunk alive.
+static bool IsSameEntryData(const SharedEntry *shared, uint64_t hash, const PackageEntry *entry)
+{
+    if (shared->hash != hash || shared->entry.type != entry->type ||
+        shared->entry.dataCompressedSize != entry->dataCompressedSize ||
+        shared->entry.dataRawSize != entry->dataRawSize) return false;
+
+    if (memcmp(shared->entry.dataCompressed, entry->dataCompressed, entry->dataCompressedSize))
+    {
+        stats.collisions++;
+        return false;
+    }
+
+    return true;
+}
+
+static void UnlinkSharedEntry(SharedEntry *shared)
+{
+    SharedEntry **link = &buckets[shared->hash & (bucketCount - 1)];
+
+    while (*link != shared) link = &(*link)->next;
+    *link = shared->next;
+
+    shared->linked = false;
+    shared->entry.dataCompressed = NULL;
+}
+
+void SetDeduplicatePackageEntries(bool val)
+{
+    dedupEnabled = val;
+}
+
+bool IsPackageDedupEnabled(void)
+{
+    return dedupEnabled;
+}
+
+PackageEntry *AcquireSharedEntry(const PackageEntry *entry, bool *decode)
+{
+    // Hashed outside of the lock, it is the expensive part.
+    uint64_t hash = HashData64(entry->dataCompressed, entry->dataCompressedSize);
+    SharedEntry *shared;
+
+    LockDedup();
+
+    stats.lookups++;
+
+    if (bucketCount)
+    {
+        for (shared = buckets[hash & (bucketCount - 1)]; shared; shared = shared->next)
+        {
+            if (IsSameEntryData(shared, hash, entry)) break;
+        }
+
+        if (shared)
+        {
+            shared->refs++;
+            stats.duplicates++;
+            stats.savedBytes += entry->dataRawSize;
+            UnlockDedup();
+
+            *decode = false;
+
+            // The first one may still be decoding it. Its nested subtasks
+            // never pick up this decode, so blocking cannot deadlock.
+            WaitForPackageEntryData(&shared->entry);
+
+            return &shared->entry;
+        }
+    }
+
+    shared = calloc(1, sizeof(SharedEntry));
+    shared->entry.type = entry->type;
+    shared->entry.group = entry->group;
+    shared->entry.instance = entry->instance;
+    shared->entry.chunkOffset = entry->chunkOffset;
+    shared->entry.compressed = true;
+    shared->entry.dataCompressed = entry->dataCompressed;
+    shared->entry.dataCompressedSize = entry->dataCompressedSize;
+    shared->entry.dataRawSize = entry->dataRawSize;
+    shared->entry.loadState = PKGENTRY_LOADING;
+    shared->hash = hash;
+    shared->refs = 1;
+    shared->linked = true;
+
+    if (++stats.sharedCount > bucketCount) GrowBuckets();
+
+    shared->next = buckets[hash & (bucketCount - 1)];
+    buckets[hash & (bucketCount - 1)] = shared;
+
+    UnlockDedup();
+
+    *decode = true;
+    return &shared->entry;
+}
+
+void PublishSharedEntry(PackageEntry *shared)
+{
+    PublishPackageEntryData(shared);
+}
+
+void ReleaseSharedEntry(PackageEntry *entry, const PackageEntry *user)
+{
+    SharedEntry *shared = (SharedEntry *)entry;
+
+    LockDedup();
+
+    // The first entry's chunk may go away with its package after this.
+    if (shared->linked && shared->entry.dataCompressed == user->dataCompressed) UnlinkSharedEntry(shared);
+
+    if (--shared->refs)
+    {
+        UnlockDedup();
+        return;
+    }
+
+    if (shared->linked) UnlinkSharedEntry(shared);
+    stats.sharedCount--;
+
+    UnlockDedup();
+
+    UnloadPackageEntryData(&shared->entry);
+    free(shared);
+}
+
+int GetSharedEntryRefCount(const PackageEntry *entry)
+{
+    LockDedup();
+
+    int refs = ((const SharedEntry *)entry)->refs;
+
+    UnlockDedup();
+
+    return refs;
+}
+
+PackageDedupStats GetPackageDedupStats(void)
+{
+    LockDedup();
+
+    PackageDedupStats ret = stats;
+
+    UnlockDedup();
+
+    return ret;
+}
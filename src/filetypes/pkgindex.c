@@ -0,0 +1,244 @@
+#include "filetypes/pkgindex.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct SortKey {
+    unsigned int k0, k1, k2;
+    int entry;
+} SortKey;
+
+static bool SameTGI(const PackageEntry *a, unsigned int type, unsigned int group, unsigned int instance)
+{
+    return a->instance == instance && a->type == type && a->group == group;
+}
+
+static void InsertSlot(PackageIndex *index, const PackageEntry *entries, int i)
+{
+    const PackageEntry *entry = &entries[i];
+    unsigned int mask = index->slotCount - 1;
+    unsigned int slot = HashTGI(entry->type, entry->group, entry->instance) & mask;
+
+    while (index->slots[slot] != -1)
+    {
+        if (SameTGI(&entries[index->slots[slot]], entry->type, entry->group, entry->instance)) break;
+        slot = (slot + 1) & mask;
+    }
+
+    index->slots[slot] = i;
+}
+
+static void GrowSlots(PackageIndex *index, const PackageEntry *entries, unsigned int entryCount)
+{
+    unsigned int slotCount = 16;
+    while (slotCount < entryCount * 2) slotCount <<= 1;
+
+    if (slotCount <= index->slotCount) return;
+
+    index->slotCount = slotCount;
+    index->slots = realloc(index->slots, sizeof(int) * slotCount);
+    memset(index->slots, -1, sizeof(int) * slotCount);
+
+    // Reinsert in entry order so the override rule still holds.
+    for (unsigned int i = 0; i < index->entryCount; i++)
+    {
+        InsertSlot(index, entries, i);
+    }
+}
+
+static int compar_sortkey(const void *p1, const void *p2)
+{
+    const SortKey *a = p1;
+    const SortKey *b = p2;
+
+    if (a->k0 != b->k0) return a->k0 < b->k0 ? -1 : 1;
+    if (a->k1 != b->k1) return a->k1 < b->k1 ? -1 : 1;
+    if (a->k2 != b->k2) return a->k2 < b->k2 ? -1 : 1;
+    return a->entry - b->entry;
+}
+
+static SortKey MakeSortKey(const PackageEntry *entries, int i, bool byGroup)
+{
+    const PackageEntry *entry = &entries[i];
+
+    if (byGroup) return (SortKey){ entry->group, entry->type, entry->instance, i };
+    return (SortKey){ entry->type, entry->group, entry->instance, i };
+}
+
+// Sorts the new entries [oldCount, entryCount) on their own, then merges them
+// into the already sorted run so extending costs O(n + m log m).
+static int *ExtendSorted(int *sorted, const PackageEntry *entries, unsigned int oldCount, unsigned int entryCount, bool byGroup)
+{
+    unsigned int newCount = entryCount - oldCount;
+    SortKey *keys = malloc(sizeof(SortKey) * newCount);
+
+    for (unsigned int i = 0; i < newCount; i++)
+    {
+        keys[i] = MakeSortKey(entries, oldCount + i, byGroup);
+    }
+
+    qsort(keys, newCount, sizeof(SortKey), compar_sortkey);
+
+    int *merged = malloc(sizeof(int) * entryCount);
+    unsigned int a = 0, b = 0, out = 0;
+
+    while (a < oldCount && b < newCount)
+    {
+        SortKey old = MakeSortKey(entries, sorted[a], byGroup);
+
+        if (compar_sortkey(&old, &keys[b]) <= 0) merged[out++] = sorted[a++];
+        else merged[out++] = keys[b++].entry;
+    }
+
+    while (a < oldCount) merged[out++] = sorted[a++];
+    while (b < newCount) merged[out++] = keys[b++].entry;
+
+    free(keys);
+    free(sorted);
+
+    return merged;
+}
+
+PackageIndex *BuildPackageIndex(const PackageEntry *entries, unsigned int entryCount)
+{
+    PackageIndex *index = calloc(1, sizeof(PackageIndex));
+
+    ExtendPackageIndex(index, entries, entryCount);
+
+    return index;
+}
+
+void ExtendPackageIndex(PackageIndex *index, const PackageEntry *entries, unsigned int entryCount)
+{
+    unsigned int oldCount = index->entryCount;
+
+    if (entryCount <= oldCount) return;
+
+    GrowSlots(index, entries, entryCount);
+
+    for (unsigned int i = oldCount; i < entryCount; i++)
+    {
+        InsertSlot(index, entries, i);
+    }
+
+    index->byType = ExtendSorted(index->byType, entries, oldCount, entryCount, false);
+    index->byGroup = ExtendSorted(index->byGroup, entries, oldCount, entryCount, true);
+    index->entryCount = entryCount;
+}
+
+static bool AreEntryPositions(const int32_t *positions, unsigned int count, unsigned int entryCount, bool allowEmpty)
+{
+    for (unsigned int i = 0; i < count; i++)
+    {
+        if (positions[i] == -1 && allowEmpty) continue;
+        if (positions[i] < 0 || (unsigned int)positions[i] >= entryCount) return false;
+    }
+
+    return true;
+}
+
+static int *CopyPositions(const int32_t *positions, unsigned int count)
+{
+    int *copy = malloc(sizeof(int) * count);
+
+    for (unsigned int i = 0; i < count; i++) copy[i] = positions[i];
+
+    return copy;
+}
+
+PackageIndex *LoadPackageIndex(unsigned int entryCount, unsigned int slotCount, const int32_t *slots, const int32_t *byType, const int32_t *byGroup)
+{
+    PackageIndex *index = calloc(1, sizeof(PackageIndex));
+
+    // An empty index has no tables at all, like BuildPackageIndex leaves it.
+    if (!entryCount) return index;
+
+    if (slotCount < entryCount * 2 || (slotCount & (slotCount - 1)) ||
+        !AreEntryPositions(slots, slotCount, entryCount, true) ||
+        !AreEntryPositions(byType, entryCount, entryCount, false) ||
+        !AreEntryPositions(byGroup, entryCount, entryCount, false))
+    {
+        free(index);
+        return NULL;
+    }
+
+    index->entryCount = entryCount;
+    index->slotCount = slotCount;
+    index->slots = CopyPositions(slots, slotCount);
+    index->byType = CopyPositions(byType, entryCount);
+    index->byGroup = CopyPositions(byGroup, entryCount);
+
+    return index;
+}
+
+void FreePackageIndex(PackageIndex *index)
+{
+    if (!index) return;
+
+    free(index->slots);
+    free(index->byType);
+    free(index->byGroup);
+    free(index);
+}
+
+int FindPackageEntry(Package pkg, unsigned int type, unsigned int group, unsigned int instance)
+{
+    PackageIndex *index = pkg.index;
+
+    if (!index || !index->slotCount) return -1;
+
+    unsigned int mask = index->slotCount - 1;
+    unsigned int slot = HashTGI(type, group, instance) & mask;
+
+    while (index->slots[slot] != -1)
+    {
+        int i = index->slots[slot];
+        if (SameTGI(&pkg.entries[i], type, group, instance)) return i;
+        slot = (slot + 1) & mask;
+    }
+
+    return -1;
+}
+
+static const int *EqualRange(const int *sorted, unsigned int count, const PackageEntry *entries, unsigned int key, bool byGroup, int *rangeCount)
+{
+    unsigned int lo = 0, hi = count;
+
+    while (lo < hi)
+    {
+        unsigned int mid = lo + (hi - lo) / 2;
+        unsigned int k = byGroup ? entries[sorted[mid]].group : entries[sorted[mid]].type;
+        if (k < key) lo = mid + 1;
+        else hi = mid;
+    }
+
+    unsigned int first = lo;
+    hi = count;
+
+    while (lo < hi)
+    {
+        unsigned int mid = lo + (hi - lo) / 2;
+        unsigned int k = byGroup ? entries[sorted[mid]].group : entries[sorted[mid]].type;
+        if (k <= key) lo = mid + 1;
+        else hi = mid;
+    }
+
+    *rangeCount = lo - first;
+    return sorted + first;
+}
+
+const int *GetPackageEntriesByType(Package pkg, unsigned int type, int *count)
+{
+    *count = 0;
+    if (!pkg.index) return NULL;
+
+    return EqualRange(pkg.index->byType, pkg.index->entryCount, pkg.entries, type, false, count);
+}
+
+const int *GetPackageEntriesByGroup(Package pkg, unsigned int group, int *count)
+{
+    *count = 0;
+    if (!pkg.index) return NULL;
+
+    return EqualRange(pkg.index->byGroup, pkg.index->entryCount, pkg.entries, group, true, count);
+}
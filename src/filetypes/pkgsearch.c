@@ -0,0 +1,169 @@
+#include "filetypes/pkgsearch.h"
+#include "filetypes/pkgindex.h"
+#include "filetypes/propnames.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+const char *GetPackageEntryTypeName(unsigned int type)
+{
+    int lo = 0, hi = BUILTIN_TYPE_COUNT;
+
+    while (lo < hi)
+    {
+        int mid = lo + (hi - lo) / 2;
+
+        if (builtinTypeIds[mid] < type) lo = mid + 1;
+        else hi = mid;
+    }
+
+    return lo < BUILTIN_TYPE_COUNT && builtinTypeIds[lo] == type ? builtinTypeNames[lo] : NULL;
+}
+
+static int compar_int(const void *p1, const void *p2)
+{
+    return *(const int *)p1 - *(const int *)p2;
+}
+
+static bool TextStartsWith(const char *t1, const char *startsWith)
+{
+    return strstr(t1, startsWith) == t1;
+}
+
+static bool IdStartsWith(unsigned int id, const char *startsWith)
+{
+    char buf[16];
+
+    snprintf(buf, sizeof(buf), "%#X", id);
+    return TextStartsWith(buf, startsWith);
+}
+
+// A full "0X%08X" string can only be a prefix of that one id.
+static bool ParseExactId(const char *str, unsigned int *id)
+{
+    char *end;
+
+    if (strlen(str) != 10 || strncmp(str, "0X", 2)) return false;
+
+    *id = strtoul(str + 2, &end, 16);
+    return *end == 0 && IdStartsWith(*id, str);
+}
+
+// Entries per chunk when a search is split across threads.
+#define SEARCH_GRAIN 4096
+
+typedef struct SearchArgs {
+    Package pkg;
+    PackageSearchParams params;
+    const int *candidates;
+} SearchArgs;
+
+typedef struct SearchResults {
+    int *results;
+    int count;
+    int capacity;
+} SearchResults;
+
+static void AppendSearchResult(SearchResults *found, int i)
+{
+    if (found->count == found->capacity)
+    {
+        found->capacity = found->capacity ? found->capacity * 2 : 64;
+        found->results = realloc(found->results, sizeof(int) * found->capacity);
+    }
+    found->results[found->count++] = i;
+}
+
+static void searchcycle(int begin, int end, void *ctx, void *partial)
+{
+    SearchArgs *args = ctx;
+    PackageSearchParams params = args->params;
+    Package pkg = args->pkg;
+
+    for (int c = begin; c < end; c++)
+    {
+        int i = args->candidates ? args->candidates[c] : c;
+        bool isCorrect = true;
+        if (params.searchInstance)
+        {
+            if (!IdStartsWith(pkg.entries[i].instance, params.instance)) isCorrect = false;
+        }
+        if (params.searchGroup)
+        {
+            if (!IdStartsWith(pkg.entries[i].group, params.group)) isCorrect = false;
+        }
+        if (params.searchType)
+        {
+            if (!IdStartsWith(pkg.entries[i].type, params.type)) isCorrect = false;
+        }
+        if (!isCorrect) continue;
+
+        AppendSearchResult(partial, i);
+    }
+}
+
+static void JoinSearchResults(void *result, void *partial, void *ctx)
+{
+    SearchResults *found = result;
+    SearchResults *chunk = partial;
+    (void)ctx;
+
+    for (int i = 0; i < chunk->count; i++) AppendSearchResult(found, chunk->results[i]);
+    free(chunk->results);
+}
+
+int *SearchPackage(Package pkg, PackageSearchParams params, int *nResults)
+{
+    int *results = NULL;
+
+    *nResults = 0;
+
+    unsigned int type, group, instance;
+    bool exactType = params.searchType && ParseExactId(params.type, &type);
+    bool exactGroup = params.searchGroup && ParseExactId(params.group, &group);
+    bool exactInstance = params.searchInstance && ParseExactId(params.instance, &instance);
+
+    if (exactType && exactGroup && exactInstance)
+    {
+        int i = FindPackageEntry(pkg, type, group, instance);
+        if (i == -1) return NULL;
+
+        results = malloc(sizeof(int));
+        results[0] = i;
+        *nResults = 1;
+        return results;
+    }
+
+    // Narrow the scan to one type's or group's run when we can.
+    const int *candidates = NULL;
+    int candidateCount = pkg.entryCount;
+
+    if (exactType && pkg.index) candidates = GetPackageEntriesByType(pkg, type, &candidateCount);
+    else if (exactGroup && pkg.index) candidates = GetPackageEntriesByGroup(pkg, group, &candidateCount);
+
+    SearchArgs args = { pkg, params, candidates };
+    SearchResults found = { 0 };
+
+    ParallelReduce(0, candidateCount, SEARCH_GRAIN, &found, sizeof(SearchResults), searchcycle, JoinSearchResults, &args);
+
+    results = found.results;
+    *nResults = found.count;
+
+    // The type/group runs are sorted by key, callers expect package order.
+    if (candidates) qsort(results, *nResults, sizeof(int), compar_int);
+
+    return results;
+}
+
+void MergePackages(Package *dest, Package src)
+{
+    int startIndex = dest->entryCount;
+
+    dest->entryCount += src.entryCount;
+    dest->entries = realloc(dest->entries, dest->entryCount * sizeof(PackageEntry));
+
+    memcpy(dest->entries + startIndex, src.entries, src.entryCount * sizeof(PackageEntry));
+
+    if (!dest->index) dest->index = BuildPackageIndex(dest->entries, dest->entryCount);
+    else ExtendPackageIndex(dest->index, dest->entries, dest->entryCount);
+}
@@ -0,0 +1,192 @@
+#include "filetypes/pkgstream.h"
+#include "filetypes/dbpf.h"
+#include <stdlib.h>
+#include <string.h>
+#include <cpl_raylib.h>
+#include <cpl_pread.h>
+#include <threadpool.h>
+
+// Most entries a stream keeps decoded at once.
+#define PKGSTREAM_MAX_SLOTS 16
+
+// One entry of the current window. The buffers grow to the largest chunk seen
+// so far and are reused by every later entry.
+typedef struct StreamSlot {
+    PackageEntry entry;
+
+    unsigned char *chunk;
+    int chunkCapacity;
+
+    unsigned char *raw;
+    int rawCapacity;
+
+    Arena arena;        // Lent to entry while it is decoded.
+} StreamSlot;
+
+struct PackageStream {
+    FILE *f;
+    IndexEntry *entries;
+    int *order;
+    int entryCount;
+
+    StreamSlot *slots;
+    int slotCount;
+
+    int windowStart;    // Into order, first entry of the current window.
+    int windowSize;
+    int current;        // Slot handed out last, -1 before the first one.
+};
+
+static unsigned char *GrowBuffer(unsigned char **buf, int *capacity, int size)
+{
+    if (size > *capacity)
+    {
+        free(*buf);
+        *buf = malloc(size);
+        *capacity = size;
+    }
+
+    return *buf;
+}
+
+// The chunk and raw data live in the slot's buffers, and the arena is only
+// reset so its block is reused by the next entry.
+static void ReleaseSlot(StreamSlot *slot)
+{
+    slot->arena = slot->entry.arena;
+    slot->entry.arena = (Arena){ 0 };
+    slot->entry.dataCompressed = NULL;
+    slot->entry.dataRaw = NULL;
+    UnloadPackageEntryData(&slot->entry);
+    ResetArena(&slot->arena);
+}
+
+static void streamcycle(int begin, int end, void *ctx)
+{
+    PackageStream *stream = ctx;
+
+    for (int s = begin; s < end; s++)
+    {
+        StreamSlot *slot = &stream->slots[s];
+        int i = stream->order[stream->windowStart + s];
+        IndexEntry entry = stream->entries[i];
+        PackageEntry *pkgEntry = &slot->entry;
+
+        *pkgEntry = (PackageEntry){ 0 };
+        pkgEntry->type = entry.type;
+        pkgEntry->group = entry.group;
+        pkgEntry->instance = entry.instance;
+        pkgEntry->chunkOffset = entry.chunkOffset;
+        pkgEntry->loadState = PKGENTRY_LOADED;
+        pkgEntry->arena = slot->arena;
+
+        unsigned char *chunk = GrowBuffer(&slot->chunk, &slot->chunkCapacity, entry.diskSize);
+
+        if (pread_file(stream->f, chunk, entry.diskSize, entry.chunkOffset) != entry.diskSize)
+        {
+            TRACELOG(LOG_ERROR, "Entry %d lies outside of the file.\n", i);
+            pkgEntry->corrupted = true;
+            continue;
+        }
+
+        SetPackageEntryChunk(pkgEntry, entry, chunk);
+
+        if (entry.isCompressed)
+        {
+            pkgEntry->dataRaw = GrowBuffer(&slot->raw, &slot->rawCapacity, entry.memSize);
+
+            if (!DecompressDBPFInto(chunk, entry.diskSize, pkgEntry->dataRaw, entry.memSize))
+            {
+                pkgEntry->corrupted = true;
+                continue;
+            }
+        }
+
+        DecodePackageEntry(pkgEntry);
+    }
+}
+
+PackageStream *OpenPackageStream(FILE *f)
+{
+    PackageStream *stream = calloc(1, sizeof(PackageStream));
+    PackageHeader header;
+
+    stream->f = f;
+    stream->entries = ReadPackageIndex(f, &header);
+    stream->entryCount = header.indexEntryCount;
+    stream->order = SortByChunkOffset(stream->entries, stream->entryCount);
+
+    // One entry per thread decodes in parallel while the caller waits.
+    stream->slotCount = GetThreadpoolThreadCount(GetCurrentThreadpool());
+    if (stream->slotCount > PKGSTREAM_MAX_SLOTS) stream->slotCount = PKGSTREAM_MAX_SLOTS;
+    if (stream->slotCount < 1) stream->slotCount = 1;
+
+    stream->slots = calloc(stream->slotCount, sizeof(StreamSlot));
+    stream->current = -1;
+
+    return stream;
+}
+
+void ClosePackageStream(PackageStream *stream)
+{
+    if (stream->current != -1) ReleaseSlot(&stream->slots[stream->current]);
+
+    for (int s = stream->current + 1; s < stream->windowSize; s++) ReleaseSlot(&stream->slots[s]);
+
+    for (int s = 0; s < stream->slotCount; s++)
+    {
+        free(stream->slots[s].chunk);
+        free(stream->slots[s].raw);
+        UnloadArena(&stream->slots[s].arena);
+    }
+
+    free(stream->slots);
+    free(stream->order);
+    free(stream->entries);
+    free(stream);
+}
+
+PackageEntry *NextPackageEntry(PackageStream *stream)
+{
+    if (stream->current != -1) ReleaseSlot(&stream->slots[stream->current]);
+
+    if (++stream->current < stream->windowSize) return &stream->slots[stream->current].entry;
+
+    stream->windowStart += stream->windowSize;
+    stream->windowSize = stream->entryCount - stream->windowStart;
+    if (stream->windowSize > stream->slotCount) stream->windowSize = stream->slotCount;
+
+    stream->current = -1;
+    if (stream->windowSize <= 0)
+    {
+        stream->windowSize = 0;
+        return NULL;
+    }
+
+    ParallelFor(0, stream->windowSize, 1, streamcycle, stream);
+
+    stream->current = 0;
+    return &stream->slots[0].entry;
+}
+
+int GetPackageStreamEntryCount(PackageStream *stream)
+{
+    return stream->entryCount;
+}
+
+int ScanPackageFile(FILE *f, bool (*fn)(PackageEntry *entry, void *ctx), void *ctx)
+{
+    PackageStream *stream = OpenPackageStream(f);
+    PackageEntry *entry;
+    int visited = 0;
+
+    while ((entry = NextPackageEntry(stream)))
+    {
+        visited++;
+        if (!fn(entry, ctx)) break;
+    }
+
+    ClosePackageStream(stream);
+
+    return visited;
+}
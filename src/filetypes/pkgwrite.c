@@ -0,0 +1,296 @@
+#include "filetypes/pkgwrite.h"
+#include "filetypes/dbpf.h"
+#include <stdlib.h>
+#include <string.h>
+#include <threadpool.h>
+#include <cpl_pthread.h>
+#include <cpl_raylib.h>
+
+// Entries in flight per worker; bounds how much compressed data is held
+// waiting for its turn to be written.
+#define EXPORT_SLOTS_PER_THREAD 4
+
+// indexType bits: the field is stored once in the index header instead of in every entry.
+#define INDEX_SHARED_TYPE     (1 << 0)
+#define INDEX_SHARED_GROUP    (1 << 1)
+#define INDEX_SHARED_INSTANCE (1 << 2) // Upper half of the instance, always 0 here.
+
+// Size of one entry when nothing is shared.
+#define INDEX_ENTRY_SIZE 32
+
+struct ExportState;
+
+typedef struct ExportSlot {
+    struct ExportState *state;
+    int entry;
+
+    unsigned char *data;    // Bytes to write; owned unless it is the entry's own dataRaw.
+    unsigned int dataSize;
+    unsigned int memSize;
+    bool compressed;
+    bool owned;
+    bool done;
+} ExportSlot;
+
+typedef struct ExportState {
+    Package pkg;
+    int level;
+    TaskGroup group;
+
+    ExportSlot *slots;
+    pthread_mutex_t mutex;
+    pthread_cond_t slotDone;
+} ExportState;
+
+static void exportcycle(void *param)
+{
+    ExportSlot *slot = param;
+    ExportState *state = slot->state;
+    PackageEntry *entry = &state->pkg.entries[slot->entry];
+
+    // Entries of a lazily loaded package may not have been decompressed yet,
+    // or be decoding on another thread: their dataRaw is only read once they
+    // are loaded. The chunk itself never changes.
+    bool loaded = __atomic_load_n(&entry->loadState, __ATOMIC_ACQUIRE) == PKGENTRY_LOADED;
+    unsigned char *entryData = loaded || !entry->compressed ? entry->dataRaw : NULL;
+    unsigned char *dataRaw = entryData;
+    if (!dataRaw && entry->compressed)
+    {
+        dataRaw = DecompressDBPF(entry->dataCompressed, entry->dataCompressedSize, entry->dataRawSize);
+    }
+
+    // Entries that failed to decompress are written empty.
+    unsigned int dataRawSize = dataRaw ? entry->dataRawSize : 0;
+
+    int dataCompressedSize = 0;
+    unsigned char *dataCompressed = state->level ? CompressDBPF(dataRaw, dataRawSize, &dataCompressedSize, state->level) : NULL;
+
+    if (dataCompressed)
+    {
+        if (dataRaw != entryData) free(dataRaw);
+        slot->data = dataCompressed;
+        slot->dataSize = dataCompressedSize;
+        slot->compressed = true;
+        slot->owned = true;
+    }
+    else
+    {
+        slot->data = dataRaw;
+        slot->dataSize = dataRawSize;
+        slot->compressed = false;
+        slot->owned = dataRaw != entryData;
+    }
+    slot->memSize = dataRawSize;
+
+    pthread_mutex_lock(&state->mutex);
+    slot->done = true;
+    pthread_cond_broadcast(&state->slotDone);
+    pthread_mutex_unlock(&state->mutex);
+}
+
+static void SubmitExportSlot(ExportState *state, ExportSlot *slot, int entry)
+{
+    slot->state = state;
+    slot->entry = entry;
+    slot->done = false;
+    NewTaskGroupTask(&state->group, exportcycle, slot);
+}
+
+typedef struct ExportOrder {
+    unsigned int type, group, instance;
+    int entry;
+} ExportOrder;
+
+static int compar_order(const void *p1, const void *p2)
+{
+    const ExportOrder *a = p1;
+    const ExportOrder *b = p2;
+
+    if (a->type != b->type) return a->type < b->type ? -1 : 1;
+    if (a->group != b->group) return a->group < b->group ? -1 : 1;
+    if (a->instance != b->instance) return a->instance < b->instance ? -1 : 1;
+
+    // Keep duplicates in their original order so the last one still wins.
+    return a->entry - b->entry;
+}
+
+// Entries are written sorted by (type, group, instance), so the index can be
+// binary searched and shared types and groups are easy to spot.
+static int *SortedEntryOrder(Package pkg)
+{
+    ExportOrder *keys = malloc(sizeof(ExportOrder) * pkg.entryCount);
+    int *order = malloc(sizeof(int) * pkg.entryCount);
+
+    for (unsigned int i = 0; i < pkg.entryCount; i++)
+    {
+        keys[i] = (ExportOrder){ pkg.entries[i].type, pkg.entries[i].group, pkg.entries[i].instance, i };
+    }
+
+    qsort(keys, pkg.entryCount, sizeof(ExportOrder), compar_order);
+
+    for (unsigned int i = 0; i < pkg.entryCount; i++) order[i] = keys[i].entry;
+
+    free(keys);
+    return order;
+}
+
+// Picks the indexType that hoists every field shared by all entries.
+static uint32_t ChooseIndexType(const IndexEntry *entries, int count)
+{
+    uint32_t indexType = INDEX_SHARED_INSTANCE;
+
+    if (!count) return indexType;
+
+    indexType |= INDEX_SHARED_TYPE | INDEX_SHARED_GROUP;
+
+    for (int i = 1; i < count && (indexType & (INDEX_SHARED_TYPE | INDEX_SHARED_GROUP)); i++)
+    {
+        if (entries[i].type != entries[0].type) indexType &= ~INDEX_SHARED_TYPE;
+        if (entries[i].group != entries[0].group) indexType &= ~INDEX_SHARED_GROUP;
+    }
+
+    return indexType;
+}
+
+static unsigned char *WriteIndexField(unsigned char *out, uint32_t value)
+{
+    memcpy(out, &value, sizeof(uint32_t));
+    return out + sizeof(uint32_t);
+}
+
+static unsigned char *WriteIndexEntry(unsigned char *out, IndexEntry entry, uint32_t indexType)
+{
+    if (!(indexType & INDEX_SHARED_TYPE)) out = WriteIndexField(out, entry.type);
+    if (!(indexType & INDEX_SHARED_GROUP)) out = WriteIndexField(out, entry.group);
+    if (!(indexType & INDEX_SHARED_INSTANCE)) out = WriteIndexField(out, 0);
+    out = WriteIndexField(out, entry.instance);
+    out = WriteIndexField(out, entry.chunkOffset);
+    out = WriteIndexField(out, entry.diskSize);
+    out = WriteIndexField(out, entry.memSize);
+    memcpy(out, &entry.compressed, 2);
+    memcpy(out + 2, &entry.unknown, 2);
+
+    return out + 4;
+}
+
+// Size of one entry once the shared fields are moved into the index header.
+static int IndexEntrySize(uint32_t indexType)
+{
+    int size = INDEX_ENTRY_SIZE;
+
+    if (indexType & INDEX_SHARED_TYPE) size -= 4;
+    if (indexType & INDEX_SHARED_GROUP) size -= 4;
+    if (indexType & INDEX_SHARED_INSTANCE) size -= 4;
+
+    return size;
+}
+
+void ExportPackage(Package pkg, const char *filename)
+{
+    ExportPackageEx(pkg, filename, REFPACK_BALANCED);
+}
+
+void ExportPackageEx(Package pkg, const char *filename, int level)
+{
+    FILE *f = fopen(filename, "wb");
+
+    if (!f)
+    {
+        perror(filename);
+        return;
+    }
+
+    PackageHeader header = { .magic = "DBPF" };
+    header.majorVersion = 3;
+    header.minorVersion = 0;
+    header.indexEntryCount = pkg.entryCount;
+    header.indexMajorVersion = 0;
+    header.indexMinorVersion = 3;
+
+    // Reserve room for the header; it is written again once the index offset is known.
+    fwrite(&header, sizeof(PackageHeader), 1, f);
+
+    IndexEntry *indexEntries = malloc(sizeof(IndexEntry) * pkg.entryCount);
+    uint32_t offset = sizeof(PackageHeader);
+
+    ExportState state = { .pkg = pkg, .level = level, .group = NewTaskGroup(GetCurrentThreadpool()) };
+    unsigned int slotCount = GetThreadpoolThreadCount(state.group.pool) * EXPORT_SLOTS_PER_THREAD;
+    unsigned int submitted = 0;
+
+    state.slots = calloc(slotCount, sizeof(ExportSlot));
+    pthread_mutex_init(&state.mutex, NULL);
+    pthread_cond_init(&state.slotDone, NULL);
+
+    int *order = SortedEntryOrder(pkg);
+
+    for (; submitted < pkg.entryCount && submitted < slotCount; submitted++)
+    {
+        SubmitExportSlot(&state, &state.slots[submitted], order[submitted]);
+    }
+
+    // Write entries in order as they finish; each written slot takes the next entry.
+    for (unsigned int i = 0; i < pkg.entryCount; i++)
+    {
+        ExportSlot *slot = &state.slots[i % slotCount];
+
+        pthread_mutex_lock(&state.mutex);
+        while (!slot->done) pthread_cond_wait(&state.slotDone, &state.mutex);
+        pthread_mutex_unlock(&state.mutex);
+
+        fwrite(slot->data, 1, slot->dataSize, f);
+
+        PackageEntry *entry = &pkg.entries[slot->entry];
+
+        indexEntries[i].type = entry->type;
+        indexEntries[i].group = entry->group;
+        indexEntries[i].instance = entry->instance;
+        indexEntries[i].chunkOffset = offset;
+        indexEntries[i].diskSize = slot->dataSize | 0x80000000;
+        indexEntries[i].memSize = slot->memSize;
+        indexEntries[i].compressed = slot->compressed ? 0xFFFF : 0x0000;
+        indexEntries[i].unknown = 0x0001;
+        offset += slot->dataSize;
+
+        if (slot->owned) free(slot->data);
+
+        if (submitted < pkg.entryCount) SubmitExportSlot(&state, slot, order[submitted++]);
+    }
+
+    WaitForTaskGroup(&state.group);
+    pthread_cond_destroy(&state.slotDone);
+    pthread_mutex_destroy(&state.mutex);
+    free(state.slots);
+
+    free(order);
+
+    uint32_t indexType = ChooseIndexType(indexEntries, pkg.entryCount);
+
+    header.indexOffset = offset;
+    header.indexSize = sizeof(uint32_t) + IndexEntrySize(indexType) * pkg.entryCount;
+    if (indexType & INDEX_SHARED_TYPE) header.indexSize += sizeof(uint32_t);
+    if (indexType & INDEX_SHARED_GROUP) header.indexSize += sizeof(uint32_t);
+    if (indexType & INDEX_SHARED_INSTANCE) header.indexSize += sizeof(uint32_t);
+
+    unsigned char *index = malloc(header.indexSize);
+    unsigned char *cur = WriteIndexField(index, indexType);
+
+    if (indexType & INDEX_SHARED_TYPE) cur = WriteIndexField(cur, indexEntries[0].type);
+    if (indexType & INDEX_SHARED_GROUP) cur = WriteIndexField(cur, indexEntries[0].group);
+    if (indexType & INDEX_SHARED_INSTANCE) cur = WriteIndexField(cur, 0);
+
+    for (unsigned int i = 0; i < pkg.entryCount; i++)
+    {
+        cur = WriteIndexEntry(cur, indexEntries[i], indexType);
+    }
+
+    fwrite(index, 1, header.indexSize, f);
+
+    fseek(f, 0, SEEK_SET);
+    fwrite(&header, sizeof(PackageHeader), 1, f);
+
+    if (ferror(f)) TRACELOG(LOG_ERROR, "Failed to write %s.\n", filename);
+    fclose(f);
+
+    free(index);
+    free(indexEntries);
+}
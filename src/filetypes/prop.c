@@ -7,62 +7,51 @@
 #include <stdio.h>
 #include <errno.h>
 #include "hash.h"
+#include "memstream.h"
+#include "filetypes/propnames.h"
 
-static float htobefloat(float x)
+PropData LoadPropData(unsigned char *data, int dataSize)
 {
-    uint32_t val = *(uint32_t*)&x;
-    val = htobe32(val);
-    float ret = *(float*)&val;
-    return ret;
+    return LoadPropDataInArena(data, dataSize, NULL);
 }
 
-static Vector2 vec2tobe(Vector2 v)
+static Vector3 ReadVector3(MemStream *stream)
 {
-    return (Vector2)
-    {
-        htobefloat(v.x),
-        htobefloat(v.y),
-    };
-}
+    Vector3 v;
 
-static Vector3 vec3tobe(Vector3 v)
-{
-    return (Vector3)
-    {
-        htobefloat(v.x),
-        htobefloat(v.y),
-        htobefloat(v.z),
-    };
-}
+    v.x = memstream_read_f32be(stream);
+    v.y = memstream_read_f32be(stream);
+    v.z = memstream_read_f32be(stream);
 
-static Vector4 vec4tobe(Vector4 v)
-{
-    return (Vector4)
-    {
-        htobefloat(v.x),
-        htobefloat(v.y),
-        htobefloat(v.z),
-        htobefloat(v.w),
-    };
+    return v;
 }
 
-PropData LoadPropData(unsigned char *data, int dataSize)
+// Reads past the end give zeros and set stream.error, which is checked before
+// each variable and array item. The last variable may run past the end, like
+// it always could.
+PropData LoadPropDataInArena(unsigned char *data, int dataSize, Arena *arena)
 {
-    unsigned char *initData = data;
-    uint32_t variableCount = htobe32(*(uint32_t *)data);
+    MemStream stream = memstream_read_create(data, dataSize);
+    uint32_t variableCount = memstream_read_be32(&stream);
     PropData propData = { 0 };
 
-    data += sizeof(uint32_t);
-
     TRACELOG(LOG_DEBUG, "Properties Info:\n");
     TRACELOG(LOG_DEBUG, "Variable count: %d\n", variableCount);
 
+    // Every variable takes at least 8 bytes.
+    if (stream.error || variableCount > (uint32_t)memstream_remaining(&stream) / 8 + 1)
+    {
+        TRACELOG(LOG_DEBUG, "{Corruption Detected: Variable Count}\n");
+        propData.corrupted = true;
+        return propData;
+    }
+
     propData.variableCount = variableCount;
-    propData.variables = malloc(sizeof(PropVariable) * propData.variableCount);
+    propData.variables = ArenaCalloc(arena, propData.variableCount, sizeof(PropVariable));
 
-    for (int i = 0; i < variableCount; i++)
+    for (uint32_t i = 0; i < variableCount; i++)
     {
-        if (data - initData > dataSize && i != variableCount - 1)
+        if (stream.error && i != variableCount - 1)
         {
             TRACELOG(LOG_DEBUG, "{Corruption Detected: Variable}\n");
             propData.corrupted = true;
@@ -71,12 +60,9 @@ PropData LoadPropData(unsigned char *data, int dataSize)
 
         TRACELOG(LOG_DEBUG, "\nVariable %d:\n", i);
 
-        uint32_t identifier = htobe32(*(uint32_t *)data);
-        data += sizeof(uint32_t);
-        uint16_t type = htobe16(*(uint16_t *)data);
-        data += sizeof(uint16_t);
-        uint16_t specifier = htobe16(*(uint16_t *)data);
-        data += sizeof(uint16_t);
+        uint32_t identifier = memstream_read_be32(&stream);
+        uint16_t type = memstream_read_be16(&stream);
+        uint16_t specifier = memstream_read_be16(&stream);
 
         TRACELOG(LOG_DEBUG, "Identifier: %#x\n", identifier);
         TRACELOG(LOG_DEBUG, "Type: %#x\n", type);
@@ -86,7 +72,7 @@ PropData LoadPropData(unsigned char *data, int dataSize)
 
         if (type == 0 && specifier == 0)
         {
-            data += sizeof(uint32_t);
+            memstream_skip(&stream, sizeof(uint32_t));
             continue;
         }
 
@@ -102,11 +88,8 @@ PropData LoadPropData(unsigned char *data, int dataSize)
         if ((specifier & 0x30) && (specifier & 0x40) == 0)
         {
             isArray = true;
-            arrayNumber = htobe32(*(int32_t *)data);
-            data += sizeof(int32_t);
-
-            arraySize = htobe32(*(int32_t *)data);
-            data += sizeof(int32_t);
+            arrayNumber = memstream_read_be32(&stream);
+            arraySize = memstream_read_be32(&stream);
 /*
             arraySize &= ~0x9C000000;*/
 
@@ -123,8 +106,6 @@ PropData LoadPropData(unsigned char *data, int dataSize)
             return propData;
         }*/
 
-        void *arrayInitData = data;
-
        if (arrayNumber & 0x40)
        {
             continue;
@@ -133,11 +114,11 @@ PropData LoadPropData(unsigned char *data, int dataSize)
        if (type == 0x38) arraySize -= 6;
 
         propData.variables[i].count = arrayNumber;
-        propData.variables[i].values = malloc(sizeof(*propData.variables[i].values) * arrayNumber);
+        propData.variables[i].values = ArenaCalloc(arena, arrayNumber, sizeof(*propData.variables[i].values));
 
         for (int j = 0; j < arrayNumber; j++)
         {
-            if (data - initData > dataSize && j != arrayNumber - 1)
+            if (stream.error && j != arrayNumber - 1)
             {
                 TRACELOG(LOG_DEBUG, "{Corruption Detected: Array}\n");
                 propData.corrupted = true;
@@ -147,14 +128,11 @@ PropData LoadPropData(unsigned char *data, int dataSize)
             {
                 case 0x20: // key type
                 {
-                    uint32_t file = htobe32(*(uint32_t *)data);
-                    data += sizeof(uint32_t);
-                    uint32_t type = htobe32(*(uint32_t *)data);
-                    data += sizeof(uint32_t);
-                    uint32_t group = htobe32(*(uint32_t *)data);
-                    data += sizeof(uint32_t);
-
-                    if (data - initData > dataSize && j != arrayNumber - 1)
+                    uint32_t file = memstream_read_be32(&stream);
+                    uint32_t type = memstream_read_be32(&stream);
+                    uint32_t group = memstream_read_be32(&stream);
+
+                    if (stream.error && j != arrayNumber - 1)
                     {
                         TRACELOG(LOG_DEBUG, "{Corruption Detected: Key Type}\n");
                         propData.corrupted = true;
@@ -163,7 +141,7 @@ PropData LoadPropData(unsigned char *data, int dataSize)
 
                     if (!isArray)
                     {
-                        // data += sizeof(uint32_t);
+                        // memstream_skip(&stream, sizeof(uint32_t));
                     }
 
                     TRACELOG(LOG_DEBUG, "File: %#x\n", file);
@@ -176,8 +154,7 @@ PropData LoadPropData(unsigned char *data, int dataSize)
                 } break;
                 case 9: // int32 type
                 {
-                    int32_t value = htobe32(*(int32_t *)data);
-                    data += sizeof(int32_t);
+                    int32_t value = memstream_read_be32(&stream);
 
                     TRACELOG(LOG_DEBUG, "Value: %#x\n", value);
 
@@ -185,16 +162,13 @@ PropData LoadPropData(unsigned char *data, int dataSize)
                 } break;
                 case 0x32: // colorRGB type
                 {
-                    float r = htobefloat(*(float *)data);
-                    data += sizeof(float);
-                    float g = htobefloat(*(float *)data);
-                    data += sizeof(float);
-                    float b = htobefloat(*(float *)data);
-                    data += sizeof(float);
+                    float r = memstream_read_f32be(&stream);
+                    float g = memstream_read_f32be(&stream);
+                    float b = memstream_read_f32be(&stream);
 
                     if (!isArray)
                     {
-                        // data += sizeof(uint32_t);
+                        // memstream_skip(&stream, sizeof(uint32_t));
                     }
 
                     TRACELOG(LOG_DEBUG, "Value: {%f, %f, %f}\n", r, g, b);
@@ -205,29 +179,29 @@ PropData LoadPropData(unsigned char *data, int dataSize)
                 } break;
                 case 0x13: // string type
                 {
-                    uint32_t length = htobe32(*(uint32_t *)data);
-                    data += sizeof(uint32_t);
+                    uint32_t length = memstream_read_be32(&stream);
 
                     length &= 0xFF;
 
                     TRACELOG(LOG_DEBUG, "Length %d\n", length);
 
-                    if ((data - initData) + length > dataSize)
+                    // UTF-16, of which only the low bytes are kept.
+                    const unsigned char *chars = memstream_take(&stream, length * 2);
+
+                    if (!chars)
                     {
                         TRACELOG(LOG_DEBUG, "{Corruption detected.}\n");
                         propData.corrupted = true;
                         return propData;
                     }
 
-                    char *str = malloc(length + 1);
+                    char *str = ArenaAlloc(arena, length + 1);
 
                     for (int i = 0; i < length; i++)
                     {
-                        str[i] = data[i * 2 + 1];
+                        str[i] = chars[i * 2 + 1];
                     }
 
-                    data += length * 2;
-
                     str[length] = 0;
 
                     TRACELOG(LOG_DEBUG, "Value: %s\n", str);
@@ -236,8 +210,7 @@ PropData LoadPropData(unsigned char *data, int dataSize)
                 } break;
                 case 0x0a: // uint32 type
                 {
-                    uint32_t value = htobe32(*(uint32_t *)data);
-                    data += sizeof(uint32_t);
+                    uint32_t value = memstream_read_be32(&stream);
 
                     TRACELOG(LOG_DEBUG, "Value: %u\n", value);
 
@@ -245,20 +218,19 @@ PropData LoadPropData(unsigned char *data, int dataSize)
                 } break;
                 case 0x12: // string8 type
                 {
-                    uint32_t length = htobe32(*(uint32_t *)data);
-                    data += sizeof(uint32_t);
+                    uint32_t length = memstream_read_be32(&stream);
+                    const unsigned char *chars = memstream_take(&stream, length);
 
-                    if ((data - initData) + length > dataSize)
+                    if (!chars)
                     {
                         TRACELOG(LOG_DEBUG, "{Corruption detected.}\n");
                         propData.corrupted = true;
                         return propData;
                     }
 
-                    char *str = malloc(length + 1);
-                    memcpy(str, data, length);
+                    char *str = ArenaAlloc(arena, length + 1);
+                    memcpy(str, chars, length);
                     str[length] = 0;
-                    data += length;
 
                     TRACELOG(LOG_DEBUG, "Value: %s\n", str);
 
@@ -266,8 +238,7 @@ PropData LoadPropData(unsigned char *data, int dataSize)
                 } break;
                 case 0x0d: // float type
                 {
-                    float value = htobefloat(*(float *)data);
-                    data += sizeof(float);
+                    float value = memstream_read_f32be(&stream);
 
                     TRACELOG(LOG_DEBUG, "Value: %f\n", value);
 
@@ -276,8 +247,9 @@ PropData LoadPropData(unsigned char *data, int dataSize)
                 case 0x30: // vector2 type
                 {
                     // Raylib's vector2 type happens to fit nicely with the description.
-                    Vector2 val = vec2tobe(*(Vector2 *)data);
-                    data += sizeof(Vector2);
+                    Vector2 val;
+                    val.x = memstream_read_f32be(&stream);
+                    val.y = memstream_read_f32be(&stream);
 
                     TRACELOG(LOG_DEBUG, "Value: {%f, %f}\n", val.x, val.y);
 
@@ -286,8 +258,7 @@ PropData LoadPropData(unsigned char *data, int dataSize)
                 case 0x31: // vector3 type
                 {
                     // Raylib's vector3 type happens to fit nicely with the description.
-                    Vector3 val = vec3tobe(*(Vector3 *)data);
-                    data += sizeof(Vector3);
+                    Vector3 val = ReadVector3(&stream);
 
                     TRACELOG(LOG_DEBUG, "Value: {%f, %f, %f}\n", val.x, val.y, val.z);
 
@@ -295,13 +266,12 @@ PropData LoadPropData(unsigned char *data, int dataSize)
 
                     if (!isArray)
                     {
-                        // data += sizeof(uint32_t);
+                        // memstream_skip(&stream, sizeof(uint32_t));
                     }
                 } break;
                 case 0x01: // bool type
                 {
-                    bool val = *(bool *)data;
-                    data += sizeof(bool);
+                    bool val = memstream_read8(&stream) != 0;
 
                     TRACELOG(LOG_DEBUG, "Value: %s\n", val ? "true" : "false");
 
@@ -309,20 +279,17 @@ PropData LoadPropData(unsigned char *data, int dataSize)
                 } break;
                 case 0x22: // texts type
                 {
+                    // Unlike the rest, these are in host order.
                     if (!isArray)
                     {
-                        arrayNumber = *(uint32_t *)data;
-                        data += sizeof(uint32_t);
-                        arraySize = *(uint32_t *)data;
-                        data += sizeof(uint32_t);
+                        arrayNumber = memstream_read32(&stream);
+                        arraySize = memstream_read32(&stream);
                     }
 
                     uint32_t arrSize = arraySize - 8;
 
-                    uint32_t textsFileSpec = *(uint32_t *)data;
-                    data += sizeof(uint32_t);
-                    uint32_t textsIdentifier = *(uint32_t *)data;
-                    data += sizeof(uint32_t);
+                    uint32_t textsFileSpec = memstream_read32(&stream);
+                    uint32_t textsIdentifier = memstream_read32(&stream);
 
                     TRACELOG(LOG_DEBUG, "Texts file spec: %#x\n", textsFileSpec);
                     TRACELOG(LOG_DEBUG, "Texts Identifier: %#x\n", textsIdentifier);
@@ -347,11 +314,8 @@ PropData LoadPropData(unsigned char *data, int dataSize)
                     // Raylib's BoundingBox type happens to fit nicely with the description.
                     BoundingBox bbox = {0};
 
-                    memcpy(&bbox, data, sizeof(BoundingBox));
-                    data += sizeof(BoundingBox);
-
-                    bbox.min = vec3tobe(bbox.min);
-                    bbox.max = vec3tobe(bbox.max);
+                    bbox.min = ReadVector3(&stream);
+                    bbox.max = ReadVector3(&stream);
 
                     TRACELOG(LOG_DEBUG, "Value: min {%f, %f, %f}, max {%f, %f, %f}\n",
                            bbox.min.x, bbox.min.y, bbox.min.z, bbox.max.x, bbox.max.y, bbox.max.z);
@@ -360,8 +324,7 @@ PropData LoadPropData(unsigned char *data, int dataSize)
                 } break;
                 case 0x38: // transform type
                 {
-                    uint16_t unknown1 = *(uint16_t*)data;
-                    data += sizeof(uint16_t);
+                    uint16_t unknown1 = memstream_read16(&stream);
 
                     TRACELOG(LOG_DEBUG, "Unknown 1: %#x\n", unknown1);
 
@@ -371,31 +334,26 @@ PropData LoadPropData(unsigned char *data, int dataSize)
 
                     for (int i = 0; i < 12; i++)
                     {
-                        unknown2[i] = htobefloat(*(float*)data);
+                        unknown2[i] = memstream_read_f32be(&stream);
                         TRACELOG(LOG_DEBUG, "Unknown2[%d] = %f\n", i, unknown2[i]);
-                        data += sizeof(float);
                     }
 
                     if (unknown1 & 0x0100)
                     {
-                        data += sizeof(uint32_t);
+                        memstream_skip(&stream, sizeof(uint32_t));
                     }
 
                 } break;
                 case 0x34: // colorRGBA type
                 {
-                    float r = htobefloat(*(float *)data);
-                    data += sizeof(float);
-                    float g = htobefloat(*(float *)data);
-                    data += sizeof(float);
-                    float b = htobefloat(*(float *)data);
-                    data += sizeof(float);
-                    float a = htobefloat(*(float *)data);
-                    data += sizeof(float);
+                    float r = memstream_read_f32be(&stream);
+                    float g = memstream_read_f32be(&stream);
+                    float b = memstream_read_f32be(&stream);
+                    float a = memstream_read_f32be(&stream);
 
                     if (!isArray)
                     {
-                        // data += sizeof(uint32_t);
+                        // memstream_skip(&stream, sizeof(uint32_t));
                     }
 
                     TRACELOG(LOG_DEBUG, "Value: {%f, %f, %f, %f}\n", r, g, b, a);
@@ -408,8 +366,11 @@ PropData LoadPropData(unsigned char *data, int dataSize)
                 case 0x33: // vector4 type
                 {
                     // Raylib's vector4 type happens to fit nicely with the description.
-                    Vector4 val = vec4tobe(*(Vector4 *)data);
-                    data += sizeof(Vector4);
+                    Vector4 val;
+                    val.x = memstream_read_f32be(&stream);
+                    val.y = memstream_read_f32be(&stream);
+                    val.z = memstream_read_f32be(&stream);
+                    val.w = memstream_read_f32be(&stream);
 
                     TRACELOG(LOG_DEBUG, "Value: {%f, %f, %f, %f}\n", val.x, val.y, val.z, val.w);
 
@@ -425,32 +386,63 @@ PropData LoadPropData(unsigned char *data, int dataSize)
         }
 
         // Weird thing in older versions of the format
-        while (data - initData + 4 < dataSize)
+        while (memstream_remaining(&stream) > 4)
         {
-            if (*(uint32_t*)data == 0)
-            {
-                data += 4;
-            }
-            else
-            {
-                break;
-            }
+            const unsigned char *next = memstream_peek(&stream, 4);
+
+            if (next[0] || next[1] || next[2] || next[3]) break;
+
+            memstream_skip(&stream, 4);
         }
 
         if (arraySize > 0)
         {
-            //data = arrayInitData + arraySize * arrayNumber;
+            //memstream_seek(&stream, arrayStart + arraySize * arrayNumber);
         }
     }
 
     return propData;
 }
 
+void UnloadPropData(PropData propData)
+{
+    for (unsigned int i = 0; i < propData.variableCount && propData.variables; i++)
+    {
+        PropVariable var = propData.variables[i];
+
+        if (!var.values) continue;
+
+        if (var.type == 0x12 || var.type == 0x13)
+        {
+            for (unsigned int j = 0; j < var.count; j++) free(var.values[j].string);
+        }
+
+        free(var.values);
+    }
+
+    free(propData.variables);
+}
+
 static bool TextStartsWith(const char *t1, const char *startsWith)
 {
     return strstr(t1, startsWith) == t1;
 }
 
+typedef struct PropertyName {
+    unsigned long id;
+    const char *name;
+    int line;
+} PropertyName;
+
+// By id, then by line so the first of several names for an id comes first.
+static int ComparePropertyNames(const void *a, const void *b)
+{
+    const PropertyName *x = a, *y = b;
+
+    if (x->id != y->id) return x->id < y->id ? -1 : 1;
+    return x->line - y->line;
+}
+
 PropertyNameList LoadPropertyNameList(const char *filename)
 {
     FILE *f = fopen(filename, "r");
@@ -465,6 +457,8 @@ PropertyNameList LoadPropertyNameList(const char *filename)
 
     char buf[1024];
     int lineNo = 0;
+    PropertyName *props = NULL;
+    int propCount = 0;
 
     while (!feof(f))
     {
@@ -479,9 +473,8 @@ PropertyNameList LoadPropertyNameList(const char *filename)
 
         //printf("%s", buf);
         
-        nameList.propCount++;
-        nameList.propIds = realloc(nameList.propIds, sizeof(unsigned long) * nameList.propCount);
-        nameList.propNames = realloc(nameList.propNames, sizeof(const char *) * nameList.propCount);
+        propCount++;
+        props = realloc(props, sizeof(PropertyName) * propCount);
 
         char *name = strchr(buf, ' ') + 1;
         int length = strchr(name, ' ') - name;
@@ -495,31 +488,60 @@ PropertyNameList LoadPropertyNameList(const char *filename)
         memcpy(nameCopy, name, length);
         nameCopy[length] = 0;
 
-        nameList.propNames[nameList.propCount - 1] = nameCopy;
-
         unsigned long id = strtoul(name + length, NULL, 16);
         if (id == 0 && strstr(name, "(hash("))
         {
             char *idStr = strchr(name + length, '(') + 6;
             int idStrLength = strchr(idStr, ')') - idStr;
 
-            char *idCopy = malloc(idStrLength + 1);
-            memcpy(idCopy, idStr, idStrLength);
-            idCopy[idStrLength] = 0;
-
-            id = TheHash(idCopy);
-
-            free(idCopy);
+            id = TheHashLength(idStr, idStrLength);
         }
 
-        nameList.propIds[nameList.propCount - 1] = id;
+        props[propCount - 1] = (PropertyName){ id, nameCopy, lineNo };
 
-        TRACELOG(LOG_DEBUG, "property name %s with id %#lX\n", nameCopy, nameList.propIds[nameList.propCount - 1]);
+        TRACELOG(LOG_DEBUG, "property name %s with id %#lX\n", nameCopy, id);
     }
 
-    TRACELOG(LOG_INFO, "Loaded %d properties\n", nameList.propCount);
+    TRACELOG(LOG_INFO, "Loaded %d properties\n", propCount);
 
     fclose(f);
 
+    qsort(props, propCount, sizeof(PropertyName), ComparePropertyNames);
+
+    unsigned long *ids = malloc(sizeof(unsigned long) * propCount);
+    const char **names = malloc(sizeof(const char *) * propCount);
+
+    for (int i = 0; i < propCount; i++)
+    {
+        ids[i] = props[i].id;
+        names[i] = props[i].name;
+    }
+
+    free(props);
+
+    nameList.propIds = ids;
+    nameList.propNames = names;
+    nameList.propCount = propCount;
+
     return nameList;
 }
+
+PropertyNameList GetBuiltinPropertyNameList(void)
+{
+    return (PropertyNameList){ builtinPropIds, builtinPropNames, BUILTIN_PROP_COUNT };
+}
+
+const char *FindPropertyName(PropertyNameList nameList, unsigned long id)
+{
+    int lo = 0, hi = nameList.propCount;
+
+    while (lo < hi)
+    {
+        int mid = lo + (hi - lo) / 2;
+
+        if (nameList.propIds[mid] < id) lo = mid + 1;
+        else hi = mid;
+    }
+
+    return lo < nameList.propCount && nameList.propIds[lo] == id ? nameList.propNames[lo] : NULL;
+}
@@ -0,0 +1,855 @@
+// Generated by gen_propnames from Properties.txt and include/filetypes/package.h. Do not edit.
+
+#include "filetypes/propnames.h"
+
+const unsigned long builtinPropIds[BUILTIN_PROP_COUNT] = {
+    0x00000000,
+    0x00000041,
+    0x00000068,
+    0x00b2ccca,
+    0x00b2cccb,
+    0x00b2cccb,
+    0x00c7c4f8,
+    0x00c7c4f9,
+    0x00c7c4fa,
+    0x00c7c4fa,
+    0x00c7c4fb,
+    0x00c7c4fc,
+    0x00c7c4fd,
+    0x00e5de84,
+    0x00e5de85,
+    0x00ed3928,
+    0x00ed3929,
+    0x00ed392a,
+    0x00f75fb6,
+    0x00f75fb7,
+    0x00f9efb9,
+    0x00f9efba,
+    0x00f9efbb,
+    0x00f9efbc,
+    0x00f9efbd,
+    0x00f9efbe,
+    0x00f9efbf,
+    0x00f9efc0,
+    0x00f9efc1,
+    0x00fba610,
+    0x00fba611,
+    0x00fba612,
+    0x00fba613,
+    0x00fba614,
+    0x00fc5228,
+    0x00fc6857,
+    0x00fc7047,
+    0x00fc704c,
+    0x00fc71fc,
+    0x00fc71fc,
+    0x00fc7205,
+    0x00fc78e7,
+    0x00fe23b2,
+    0x00fe2437,
+    0x00fe243b,
+    0x00fe243f,
+    0x0100eab6,
+    0x0100eab7,
+    0x0100eab8,
+    0x0100eab9,
+    0x0100eaba,
+    0x0100eabb,
+    0x0100eabc,
+    0x0100eabd,
+    0x0100eabe,
+    0x0100eabf,
+    0x0100eac0,
+    0x0100eac1,
+    0x0100eac2,
+    0x0100eac3,
+    0x0100eac4,
+    0x0100eac5,
+    0x0100eac6,
+    0x0100eac7,
+    0x0100eac8,
+    0x0100eac9,
+    0x0100eaca,
+    0x0100eacb,
+    0x0100eacd,
+    0x0100eace,
+    0x0100eacf,
+    0x01102b20,
+    0x01102b2f,
+    0x015e0f54,
+    0x015e688f,
+    0x015e6baa,
+    0x015e84cd,
+    0x02280abf,
+    0x02280ac8,
+    0x02438a8b,
+    0x02478ed7,
+    0x02478eda,
+    0x02478edb,
+    0x02478edc,
+    0x02478edd,
+    0x02478ede,
+    0x02478edf,
+    0x02478ee0,
+    0x02478ee1,
+    0x02478ee2,
+    0x02478ee3,
+    0x02478ee4,
+    0x0248f226,
+    0x026b7d69,
+    0x026cabbf,
+    0x026dc91e,
+    0x027c5cef,
+    0x027c7387,
+    0x027f36b9,
+    0x027f36ba,
+    0x027f36bb,
+    0x0292ec21,
+    0x02a907b5,
+    0x02a907b5,
+    0x02a907b6,
+    0x02a907b7,
+    0x02a907b8,
+    0x02a907b9,
+    0x02a907b9,
+    0x02a907ba,
+    0x02e33a81,
+    0x02e765cf,
+    0x02e765d0,
+    0x02e765d1,
+    0x02e765d2,
+    0x030bc65a,
+    0x031d2791,
+    0x031d2792,
+    0x04334f33,
+    0x04334f34,
+    0x043afa7e,
+    0x043b1ec5,
+    0x044c6220,
+    0x0452027c,
+    0x0452027d,
+    0x0452027e,
+    0x0452027f,
+    0x0461709d,
+    0x0461709e,
+    0x0461709f,
+    0x046170a0,
+    0x046170a1,
+    0x046170a2,
+    0x046170a4,
+    0x046170a5,
+    0x046170a6,
+    0x0463d294,
+    0x046425b0,
+    0x046425ce,
+    0x0473b8cb,
+    0x0473b8cc,
+    0x04754439,
+    0x0477d61d,
+    0x049b48ee,
+    0x049b94d4,
+    0x049b94d5,
+    0x049b94d6,
+    0x049fc837,
+    0x049fc837,
+    0x049fc838,
+    0x049fc838,
+    0x049fc838,
+    0x049fc838,
+    0x049fc839,
+    0x049fc839,
+    0x049fc83a,
+    0x049fc83a,
+    0x04a5b8d2,
+    0x04adacd8,
+    0x04adacd9,
+    0x04adacda,
+    0x04c08536,
+    0x04c08537,
+    0x04c08538,
+    0x04c6ba29,
+    0x04c6ba3c,
+    0x04ee8a87,
+    0x04efaf18,
+    0x04efbdc8,
+    0x04efd359,
+    0x05107b17,
+    0x05107b18,
+    0x05107b19,
+    0x05107b1a,
+    0x05108509,
+    0x0510a385,
+    0x0521fc0e,
+    0x052f7b17,
+    0x055a7c84,
+    0x055a7c85,
+    0x0566cae9,
+    0x0566caea,
+    0x05678419,
+    0x0567841a,
+    0x056784b9,
+    0x056784ba,
+    0x056784c9,
+    0x056784ca,
+    0x056784d9,
+    0x056784da,
+    0x056784e9,
+    0x056784ea,
+    0x056784f9,
+    0x056784fa,
+    0x05879278,
+    0x05879279,
+    0x0587927a,
+    0x0587927b,
+    0x05b99de4,
+    0x05b9a1ec,
+    0x05b9a4fb,
+    0x05c9482d,
+    0x05c97448,
+    0x05d1b951,
+    0x05d1b952,
+    0x05daaffe,
+    0x05daafff,
+    0x05dab000,
+    0x05dab001,
+    0x05dd4647,
+    0x060cbbef,
+    0x06148bad,
+    0x0614a8f1,
+    0x061594ab,
+    0x0615a51a,
+    0x061b67b6,
+    0x061b99cd,
+    0x061b99ce,
+    0x061b99cf,
+    0x0625e847,
+    0x063ab656,
+    0x064dab03,
+    0x067b804d,
+    0x0680a2b1,
+    0x0681a110,
+    0x068ce755,
+    0x0692e9aa,
+    0x0696cb45,
+    0x06ef59e4,
+    0x06ef59e5,
+    0x06ef59e6,
+    0x06ef59e7,
+    0x06ef59e8,
+    0x06ef59e9,
+    0x06ef59ea,
+    0x06ef59eb,
+    0x07634d70,
+    0x08240c5e,
+    0x08e452f0,
+    0x08e452f1,
+    0x08e452f2,
+    0x09f18abe,
+    0x09f18abf,
+    0x09f18ac0,
+    0x09f18ac1,
+    0x0aaf2940,
+    0x0aaf2941,
+    0x0aaf2942,
+    0x0aaf2943,
+    0x0aaf2944,
+    0x0aaf2945,
+    0x0aaf2950,
+    0x0aaf2951,
+    0x0abd89fd,
+    0x0c357b70,
+    0x0c541183,
+    0x0d9a6060,
+    0x0e619e57,
+    0x0e619e58,
+    0x0e7422ce,
+    0x0e7bf0d5,
+    0x0e881409,
+    0x0e9513b4,
+    0x0ec4a693,
+    0x0ed71bca,
+    0x0ee02eba,
+    0x0ee6a981,
+    0x0ee6dd0a,
+    0x0ee9a303,
+    0x0eeb4268,
+    0x0eebfe4b,
+    0x0ef18906,
+    0x0efe44d8,
+    0x0f11225d,
+    0x0f1e2951,
+    0x0f1f7006,
+    0x0f1f7017,
+    0x0f236dab,
+    0x0f2b34d1,
+    0x0f30a0fa,
+    0x0f362827,
+    0x0f362828,
+    0x0f362829,
+    0x0f362830,
+    0x0f362831,
+    0x0f362832,
+    0x0f362833,
+    0x0f362834,
+    0x0f362835,
+    0x0ffe72cc,
+    0x108f3b4c,
+    0x10a469a8,
+    0x1193d5a2,
+    0x1285b385,
+    0x13d66f4c,
+    0x1750b8d0,
+    0x197d1bac,
+    0x1a34e253,
+    0x1b207885,
+    0x283d4540,
+    0x2929a109,
+    0x2ac0c32f,
+    0x2ce67c26,
+    0x2e3dc7a1,
+    0x2f1f7f46,
+    0x2fbed121,
+    0x34862ea5,
+    0x36885f02,
+    0x372f49bc,
+    0x382e577b,
+    0x38db701e,
+    0x390b3195,
+    0x3fd229c1,
+    0x40f12c4b,
+    0x4629edb4,
+    0x4b4a53e5,
+    0x4f1afd14,
+    0x510d7cc9,
+    0x51b5a908,
+    0x53f8821f,
+    0x5485caea,
+    0x57ea2e73,
+    0x59df960c,
+    0x5b0e8005,
+    0x5de83b3f,
+    0x631ef4f1,
+    0x66ece90f,
+    0x687a9b5b,
+    0x69c90ad5,
+    0x6a334aa8,
+    0x6aa86d92,
+    0x6b331995,
+    0x6b8241c9,
+    0x6fda2e1c,
+    0x70268737,
+    0x705ee75d,
+    0x74402b5b,
+    0x775d6ac5,
+    0x77bd4c46,
+    0x7d8ed666,
+    0x7e62b181,
+    0x7f59bfc3,
+    0x7fd4efcc,
+    0x81caa3d6,
+    0x844ccdc3,
+    0x85d3dd2e,
+    0x8786ba7f,
+    0x8a7caabb,
+    0x8fda2e23,
+    0x94b585e7,
+    0x9517e90e,
+    0x96fd13ee,
+    0xa0bc0ef1,
+    0xa5bbb508,
+    0xa5fe6feb,
+    0xa79e5398,
+    0xab5d9c79,
+    0xac114d6c,
+    0xbd63e8ef,
+    0xbf455a17,
+    0xc2eaba92,
+    0xc4bb2e00,
+    0xcb53e119,
+    0xcc23a94f,
+    0xcd5e2038,
+    0xd06d26d1,
+    0xd0725daa,
+    0xd124fce4,
+    0xd124fce7,
+    0xd3bb1b04,
+    0xd4baa2fe,
+    0xd4c214fc,
+    0xd5dceff5,
+    0xd6933d37,
+    0xd8d42c59,
+    0xd9ddcc52,
+    0xda7639f9,
+    0xdb8b6bf2,
+    0xdcd55da1,
+    0xde050ce9,
+    0xe30a842c,
+    0xe62031ea,
+    0xe6eee50a,
+    0xe7798f2d,
+    0xed8a8941,
+    0xef26b5eb,
+    0xef919d10,
+    0xf372f846,
+    0xf919f728,
+};
+
+const char *const builtinPropNames[BUILTIN_PROP_COUNT] = {
+    "packageSignature",
+    "MRT",
+    "RenderTargetCorrection",
+    "description",
+    "template",
+    "parent",
+    "cameraZoomScale",
+    "cameraRotateScale",
+    "cameraTranslateScale",
+    "cameraInitialTarget",
+    "cameraInitialZoom",
+    "cameraInitialPitch",
+    "cameraInitialHeading",
+    "ModelToLoad",
+    "MVHandleSize",
+    "cameraType",
+    "cameraName",
+    "cameraBackgroundColor",
+    "defaultMinChange",
+    "defaultRate",
+    "modelBoundingRadius",
+    "modelBoundingBox",
+    "modelMeshLOD0",
+    "modelMeshLOD1",
+    "modelMeshLOD2",
+    "modelMeshLOD3",
+    "modelMeshLowRes",
+    "modelMeshHull",
+    "modelMeshLODHi",
+    "modelOffset",
+    "modelScale",
+    "modelColor",
+    "modelRotation",
+    "modelZCorpMinScale",
+    "cameraDistances",
+    "cameraFOVs",
+    "cameraNearClips",
+    "cameraFarClips",
+    "cameraPitches",
+    "cameraMinPitches",
+    "cameraMaxPitches",
+    "cameraOrientations",
+    "cameraMinZoomDistance",
+    "cameraMaxZoomDistance",
+    "cameraMinPitch",
+    "cameraMaxPitch",
+    "skylight",
+    "skylightStrength",
+    "lightSunDir",
+    "lightSunColor",
+    "lightSunStrength",
+    "lightSkyDir",
+    "lightSkyColor",
+    "lightSkyStrength",
+    "lightFill1Dir",
+    "lightFill1Color",
+    "lightFill1Strength",
+    "lightFill2Dir",
+    "lightFill2Color",
+    "lightFill2Strength",
+    "exposure",
+    "shCoeffs",
+    "cameraSpaceLighting",
+    "pointLightPos",
+    "pointLightColor",
+    "pointLightStrength",
+    "pointLightRadius",
+    "envHemiMap",
+    "atmosphere",
+    "diffBounce",
+    "specBounce",
+    "cameraNearClip",
+    "cameraFarClip",
+    "cameraExponential",
+    "cameraWheelZoomScale",
+    "cameraExpPanScale",
+    "cameraPanSubjectPos",
+    "paramOffsets",
+    "paramNames",
+    "cameraPitchScale",
+    "planetAtmosphere",
+    "planetBounceDiff",
+    "planetBounceSpec",
+    "planetSunBoost",
+    "planetTransitionBoost",
+    "planetNightBoost",
+    "planetDayStart",
+    "planetDayRange",
+    "planetNightStart",
+    "planetNightRange",
+    "planetSaturation",
+    "planetFogStrength",
+    "UILocalizedResourceGroups_TypeID_CSS",
+    "horizonCullFactor",
+    "AmbOccAOMul",
+    "AmbOccAOBias",
+    "UILocalizedResourceGroups_TypeID_TTF",
+    "AmbOccBlurAmount",
+    "shadowCameraRange",
+    "shadowScaleCurve",
+    "shadowStrengthCurve",
+    "tutorial_MSTutorialDLC_Nissan_Leaf",
+    "modelEffect",
+    "modelEffects",
+    "modelEffectTransforms",
+    "modelEffectSeed",
+    "modelEffectRange",
+    "modelEffectWorld",
+    "modelEffectWorlds",
+    "modelEffectsSoftStop",
+    "modelLODDistances",
+    "modelLODFactor0",
+    "modelLODFactor1",
+    "modelLODFactor2",
+    "modelLODFactor3",
+    "cameraMaterialLODs",
+    "modelDefaultBoundingBox",
+    "modelDefaultBoundingRadius",
+    "ExtensionMap",
+    "DefaultGroup",
+    "modelName",
+    "UILocalizedResourceGroups_TypeID_OTF",
+    "cameraInitialFOV",
+    "modelLODFlags0",
+    "modelLODFlags1",
+    "modelLODFlags2",
+    "modelLODFlags3",
+    "OptionDefaultsSet",
+    "OptionShadows",
+    "OptionTextureDetail",
+    "OptionEffects",
+    "OptionScreenSize",
+    "OptionFullScreen",
+    "OptionDiskCacheSize",
+    "OptionFitToScreen",
+    "OptionLighting",
+    "creditsNames",
+    "movieRes",
+    "photoRes",
+    "OptionPhotoRes",
+    "OptionVideoRes",
+    "OptionVersion",
+    "envCubeMap",
+    "modelPreloads",
+    "lightingCel",
+    "planetCelRange",
+    "lightLargeModelRadius",
+    "modelLightStrength",
+    "modelLightStrengths",
+    "modelLightColor",
+    "modelLightColour",
+    "modelLightColors",
+    "modelLightColours",
+    "modelLightSize",
+    "modelLightSizes",
+    "modelLightOffset",
+    "modelLightOffsets",
+    "modelSound",
+    "decalLightEnabled",
+    "decalLightStrength",
+    "decalLightSize",
+    "highlightCurve",
+    "highlightLife",
+    "highlightColors",
+    "modelBakeTextureSize",
+    "modelBakeQuality",
+    "AmbOccViewWindow",
+    "AmbOccSamplesType",
+    "AmbOccSamplesZOffset",
+    "AmbOccSamplesInvert",
+    "dialogButton0",
+    "dialogButton1",
+    "dialogButton2",
+    "dialogButton3",
+    "dialogOKButton",
+    "dialogSelectedButton",
+    "modelAmbientOcclusion",
+    "modelBakeTextureDXT",
+    "dialogEscButton",
+    "dialogEnterButton",
+    "shAreaLights",
+    "shHemiLight",
+    "shAreaLightsScale",
+    "shAreaLightsZRM",
+    "shCoeffsScale",
+    "shCoeffsZRM",
+    "envHemiMapScale",
+    "envHemiMapZRM",
+    "envCubeMapScale",
+    "envCubeMapZRM",
+    "atmosphereScale",
+    "atmosphereZRM",
+    "shHemiLightScale",
+    "shHemiLightZRM",
+    "shadowTargetSnap",
+    "shadowDirSnap",
+    "shadowDirLerp",
+    "shadowScaleSnap",
+    "AmbOccNumSamples",
+    "modelAmbOccStreamMesh",
+    "modelAmbOccTuningFile",
+    "OptionGameQuality",
+    "NumFramesToBuffer",
+    "shadowCasterDistance",
+    "shadowDepthRange",
+    "OptionListTarget",
+    "OptionIDs",
+    "OptionStartSettings",
+    "OptionEndSettings",
+    "AlwaysFullscreen",
+    "modelMeshAnimSharing",
+    "shadowNestFactor",
+    "shadowNestScaleCurve",
+    "dialogLayout",
+    "dialogDisableByOptions",
+    "MacSpecificText",
+    "modelQuantizeScales",
+    "modelQuantizeTypeTags",
+    "modelQuantizeBoneDir",
+    "shadowHorizonFade",
+    "Support51Audio",
+    "planetAtmosphereUpdateTheta",
+    "modelBakeMeshBudget",
+    "modelBakeTextureDilate",
+    "shadowNightLightStart",
+    "shadowNestCameraRange",
+    "shadowAwayBias",
+    "planetAtmosphereOnly",
+    "packageTitle",
+    "packagePriority",
+    "packageRequirements",
+    "packageID",
+    "packageBlessCheck",
+    "packageProductKey",
+    "packageRegistryKey",
+    "packageEntitleCheck",
+    "packageSteamAppID",
+    "shadowDirection",
+    "cameraPlanarMovementRate",
+    "cameraHeadingRotationRate",
+    "cameraPitchRotationRate",
+    "modelDecimationFactor0",
+    "modelDecimationFactor1",
+    "modelDecimationFactor2",
+    "modelDecimationFactor3",
+    "AudioMasterVolume",
+    "AudioAmbienceVolume",
+    "AudioMusicVolume",
+    "AudioSFXVolume",
+    "AudioUIVolume",
+    "AudioVOXVolume",
+    "AudioMuteAll",
+    "AudioSpeakerMode",
+    "cameraStartingDistance",
+    "UpdateChannel",
+    "tutorial_MSTutorialDLC_PartnerMetro",
+    "OptionDisasterSlowdown",
+    "OptionPeopleQuality",
+    "OptionSignQuality",
+    "OptionUIZoomLevel",
+    "OptionGamma",
+    "tutorial_MSTutorialRegionMassTranist",
+    "OptionDisplayPathGuides",
+    "OptionCityImpostorQuality",
+    "OptionDisplayCityBoundary",
+    "OptionGeometryDetail",
+    "OptionAnimationDetail",
+    "OptionMovieRecordNoUI",
+    "OptionFXAA",
+    "OptionNoWindowBorders",
+    "OptionDOFStrength",
+    "OptionFarCamera",
+    "OptionPictureFilter",
+    "OptionEdgeScroll",
+    "OptionFramerateCap",
+    "OptionHideSpeechBubbles",
+    "OptionHideThoughtBubbles",
+    "OptionHideVehicleAvatars",
+    "OptionVsync",
+    "IsIntelIntegratedGPU",
+    "scWorldGame",
+    "scWorldRest",
+    "scWorldSocket",
+    "scWorldTelem",
+    "scWorldId",
+    "scWorldNameId",
+    "scWorldServiceNews",
+    "scWorldConnect",
+    "scWorldSub",
+    "OptionCameraGestureControl",
+    "OptionMotionBlur",
+    "scOfflinePref",
+    "tutorial_MSTutorialDLC_PartnerMicroMania",
+    "scInfoDisplayCount",
+    "tutorial_MSCivicTutorialGamblingIncProfitTransit",
+    "tutorial_MSCivicTutorialGamblingPassengerTrains",
+    "tutorial_MSCivicTutorialGamblingIncreasingProfit",
+    "ShaderPath",
+    "tutorial_MSTutorialDLC_HeroesAndVillains",
+    "WebkitEnableEnableJavaScriptDebugOutput",
+    "tutorial_MSCivicTutorialGamblingGamingDiv",
+    "tutorial_MSTutorialGiftingCoal",
+    "tutorial_MSTutorialMiniGreatWorks",
+    "WebkitEnableImageCacheCompression",
+    "tutorial_MSTutorialDLC_PartnerPlay",
+    "tutorial_MSTutorialDLC_EP1Drones",
+    "OptionEnableAutosave",
+    "tutorial_MSTutorialLandValue",
+    "perfColors",
+    "tutorial_MSTutorialDLC_Crest",
+    "tutorial_MSTutorialSharingHealthServices",
+    "tutorial_MSTutorialCoalMinePlacement",
+    "tutorial_MSTutorialRoadUpgrades",
+    "tutorial_MSTutorialDLC_Airships",
+    "dialogText",
+    "tutorial_MSTutorialClaimCity",
+    "tutorial_MSTutorialSharingFireServices",
+    "tutorial_MSTutorialOilWellPlacement",
+    "tutorial_MSTutorialDLC_Worship",
+    "tutorial_MSTutorialGiftingSimoleons",
+    "tutorial_MSTutorialDLC_Berlin",
+    "tutorial_MSTutorialDLC_3CitySets",
+    "tutorial_MSTutorialTradeDepot",
+    "tutorial_MSTutorialDLC_PartnerTelia",
+    "WebkitCookieDiskSizeKilobytes",
+    "tutorial_MSTutorialMyFirstCity",
+    "tutorial_MSTutorialTradingSims",
+    "tutorial_MSTutorialTradingSewage",
+    "tutorial_MSTutorialSharingGarbageServices",
+    "tutorial_MSTutorialTradingWater",
+    "tutorial_MSCivicTutorialGamblingLodgingDiv",
+    "tutorial_MSTutorialDLC_EP1MegaTower",
+    "dialogTitle",
+    "cameraInitialOffsetX",
+    "tutorial_MSTutorialDLC_Progressive",
+    "OptionGameCamera",
+    "scOfflineLastPlayedBoxId",
+    "tutorial_MSTutorialDLC_EP1Radiation",
+    "WebkitCookieDirectory",
+    "OptionAudioPerformance",
+    "tutorial_MSTutorialDLC_LaunchMemorialPark",
+    "WebkitJavascriptStackSizeKilobytes",
+    "tutorial_MSTutorialDLC_London",
+    "tutorial_MSCivicTutorialGamblingHall",
+    "tutorial_MSTutorialHappiness",
+    "tutorial_MSTutorialSharingPoliceServices",
+    "WebkitThrottleMouseMove",
+    "tutorial_GettingStartedScenario",
+    "cameraInitialOffsetY",
+    "tutorial_MSTutorialDLC_EP1CitiesOfTomorrow",
+    "WebkitCookieMaxCount",
+    "WebkitDirtyRectangleUpdates",
+    "OptionCameraPanMode",
+    "dropShadowQualityImage",
+    "WebkitDiskCacheDirectory",
+    "perfLimits",
+    "tutorial_MSTutorialDLC_PartnerMediaMarkt",
+    "WebkitDiskCacheSizeMegabytes",
+    "tutorial_MSTutorialDLC_EP1OmegaCo",
+    "tutorial_MSTutorialTradePort",
+    "tutorial_MSTutorialDLC_AmusementParkMiniTutorial",
+    "tutorial_MSCivicTutorialGamblingAirport",
+    "WebkitUserAgent",
+    "tutorial_MSCivicTutorialGamblingEntDiv",
+    "perfPositions",
+    "OptionDisableOfflineTelem",
+    "tutorial_MSTutorialGiftingOil",
+    "modelSprite0",
+    "modelSprite1",
+    "WebkitCookieMaxIndividualSizeBytes",
+    "WebkitDrawIntermediatePages",
+    "tutorial_MSTutorialDensity",
+    "perfLabels",
+    "tutorial_MSTutorialDLC_RomanLuckCasino",
+    "WebkitEnableGammaCorrection",
+    "WebkitRamCacheSizeKilobytes",
+    "tutorial_MSTutorialBudgetUI",
+    "dialogTimeout",
+    "EffectsInstancing",
+    "tutorial_MSTutorialDLC_EP1EntitledNeighbor",
+    "dropShadowQualityText",
+    "OptionShowTutorials",
+    "tutorial_MSTutorialTradingPower",
+    "WebkitRamCachePageCount",
+    "tutorial_MSTutorialDLC_RedCross",
+    "tutorial_MSTutorialDLC_Paris",
+    "tutorial_MSTutorialDLC_EP1Academy",
+    "OptionDisableDisasters",
+    "tutorial_MSTutorialDLC_AmusementParks",
+};
+
+const unsigned int builtinTypeIds[BUILTIN_TYPE_COUNT] = {
+    0x00b1b104,
+    0x00e6bce5,
+    0x011989b7,
+    0x024a0e52,
+    0x02fac0b6,
+    0x0376c3da,
+    0x0469a3f7,
+    0x08068aeb,
+    0x08068aec,
+    0x0a4d8d09,
+    0x0a98eaf0,
+    0x0d9e5710,
+    0x1a99b06b,
+    0x2399be55,
+    0x24682294,
+    0x276ca4b9,
+    0x2b978c46,
+    0x2c978db6,
+    0x2f4e681b,
+    0x2f4e681c,
+    0x2f7d0002,
+    0x2f7d0004,
+    0x2f7d0006,
+    0x2f7d0007,
+    0x376840d7,
+    0x3f8662ea,
+    0x438f6347,
+    0x476a98c7,
+    0x67771f5c,
+    0xdd6233d6,
+    0xea5118b0,
+};
+
+const char *const builtinTypeNames[BUILTIN_TYPE_COUNT] = {
+    "PROP",
+    "GMDL",
+    "PLT",
+    "SCPT",
+    "TEXT",
+    "HM",
+    "SHDR",
+    "RULE",
+    "ER2",
+    "BNK",
+    "JSON",
+    "WEM",
+    "BEM",
+    "BLD",
+    "VCL",
+    "TTF",
+    "CRT",
+    "CSS",
+    "RW4",
+    "RAST",
+    "JPEG",
+    "PNG",
+    "TGA",
+    "GIF",
+    "MOV",
+    "EXIF",
+    "FLR",
+    "UFO",
+    "JSN8",
+    "HTML",
+    "SWB",
+};
@@ -1,6 +1,7 @@
 #include "filetypes/rast.h"
+#include "threadpool.h"
+#include "memstream.h"
 #include <stdint.h>
-#include <cpl_endian.h>
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
@@ -24,23 +25,52 @@ typedef struct RasterFile {
     RasterFileImage *images;
 } RasterFile;
 
+// Pixels per chunk when the conversion is split across threads.
+#define RAST_PIXEL_GRAIN 16384
+
+typedef struct PixelSwizzleArgs {
+    const uint8_t *src;
+    Color *dst;
+} PixelSwizzleArgs;
+
+// BGRA to RGBA.
+static void pixelcycle(int begin, int end, void *ctx)
+{
+    PixelSwizzleArgs *args = ctx;
+
+    for (int j = begin; j < end; j++)
+    {
+        const uint8_t *p = args->src + 4*j;
+        args->dst[j] = (Color){p[2], p[1], p[0], p[3]};
+    }
+}
+
 RastData LoadRastData(unsigned char *data, int dataSize)
+{
+    return LoadRastDataInArena(data, dataSize, NULL);
+}
+
+RastData LoadRastDataInArena(unsigned char *data, int dataSize, Arena *arena)
 {
     RastData rastData = { 0 };
     TRACELOG(LOG_DEBUG, "Raster info:\n");
     RasterFile file = { 0 };
 
-    unsigned char *initData = data;
+    MemStream stream = memstream_read_create(data, dataSize);
 
-    memcpy(&file.header, data, sizeof(RasterFileHeader));
-    data += sizeof(RasterFileHeader);
+    file.header.type = memstream_read_be32(&stream);
+    file.header.width = memstream_read_be32(&stream);
+    file.header.height = memstream_read_be32(&stream);
+    file.header.mipmapct = (memstream_read_be32(&stream) & 0xFF) >> 1;
+    file.header.pixelwidth = memstream_read_be32(&stream) & 0xFF;
+    file.header.pixelformat = memstream_read_be32(&stream) & 0xFF;
 
-    file.header.type = htobe32(file.header.type);
-    file.header.width = htobe32(file.header.width);
-    file.header.height = htobe32(file.header.height);
-    file.header.mipmapct = (htobe32(file.header.mipmapct) & 0xFF) >> 1;
-    file.header.pixelwidth = htobe32(file.header.pixelwidth) & 0xFF;
-    file.header.pixelformat = htobe32(file.header.pixelformat) & 0xFF;
+    if (stream.error)
+    {
+        TRACELOG(LOG_ERROR, "Raster header is truncated.\n");
+        rastData.corrupted = true;
+        return rastData;
+    }
 
     TRACELOG(LOG_DEBUG, "Type: %d\n", file.header.type);
     TRACELOG(LOG_DEBUG, "Width: %d\n", file.header.width);
@@ -63,47 +93,42 @@ RastData LoadRastData(unsigned char *data, int dataSize)
         return rastData;
     }
 
-    file.images = malloc(sizeof(RasterFileImage) * file.header.mipmapct);
+    // Widened, a large enough width and height would wrap around in 32 bits.
+    uint64_t pixelCount = (uint64_t)file.header.width*file.header.height;
+
+    if (4*pixelCount > (uint64_t)dataSize)
+    {
+        TRACELOG(LOG_WARNING, "{Corruption Detected.}\n");
+        rastData.corrupted = true;
+        return rastData;
+    }
+
+    RasterFileImage rastImg = { 0 };
+
+    rastImg.blocksize = memstream_read_be32(&stream);
+
+    TRACELOG(LOG_DEBUG, "Image 0: Blocksize %d\n", rastImg.blocksize);
+
+    // Only the first image is loaded; the mipmaps after it are not needed.
+    const unsigned char *pixels = memstream_take(&stream, 4*pixelCount);
+
+    if (!pixels)
+    {
+        TRACELOG(LOG_WARNING, "{Corruption Detected.}\n");
+        rastData.corrupted = true;
+        return rastData;
+    }
+
     Image img = { 0 };
 
     img.width = file.header.width;
     img.height = file.header.height;
     img.mipmaps = 1;
     img.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
-    Color *imgData = malloc(file.header.width*file.header.height*sizeof(Color));
+    Color *imgData = ArenaAlloc(arena, pixelCount*sizeof(Color));
 
-    for (int i = 0; i < 1; i++)
-    {
-        RasterFileImage rastImg = { 0 };
-
-        if (4*file.header.width*file.header.height > dataSize)
-        {
-            TRACELOG(LOG_WARNING, "{Corruption Detected.}\n");
-            rastData.corrupted = true;
-            return rastData;
-        }
-
-        rastImg.blocksize = htobe32(*(uint32_t*)data);
-        data += sizeof(uint32_t);
-
-        TRACELOG(LOG_DEBUG, "Image %d: Blocksize %d\n", i, rastImg.blocksize);
-
-        for (int j = 0; j < file.header.width*file.header.height; j++)
-        {
-            uint8_t b = *(uint8_t*)data;
-            data++;
-            uint8_t g = *(uint8_t*)data;
-            data++;
-            uint8_t r = *(uint8_t*)data;
-            data++;
-            uint8_t a = *(uint8_t*)data;
-            data++;
-
-            imgData[j] = (Color){r, g, b, a};
-
-            //printf("%d/%d: %d, %d, %d, %d.\n", i*4, rastImg.blocksize, r, g, b, a);
-        }
-    }
+    PixelSwizzleArgs args = { pixels, imgData };
+    ParallelFor(0, pixelCount, RAST_PIXEL_GRAIN, pixelcycle, &args);
 
     img.data = imgData;
     TRACELOG(LOG_DEBUG, "Loaded.\n");
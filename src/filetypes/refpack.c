@@ -0,0 +1,626 @@
+#include "filetypes/refpack.h"
+#include <stdlib.h>
+#include <string.h>
+
+// Wide copies may run this far past the bytes they were asked for, so they are
+// only used while both buffers have at least this much room left.
+#define REFPACK_SLACK 32
+
+// While this much input and output is left, no single command can run off the
+// end of either buffer even with wide copies: the longest literal run is 112
+// bytes and the longest command outputs 3 + 1028 bytes.
+#define REFPACK_FAST_IN (4 + 112 + REFPACK_SLACK)
+#define REFPACK_FAST_OUT (3 + 1028 + REFPACK_SLACK)
+
+// Fixed-size memcpy compiles to unaligned vector loads and stores.
+static inline void copy4(uint8_t *dst, const uint8_t *src)
+{
+    memcpy(dst, src, 4);
+}
+
+static inline void copy16(uint8_t *dst, const uint8_t *src)
+{
+    memcpy(dst, src, 16);
+}
+
+static inline void copy32(uint8_t *dst, const uint8_t *src)
+{
+    memcpy(dst, src, 32);
+}
+
+// Copies len bytes in 32-byte chunks, writing up to 31 bytes past dst + len.
+static inline void wild_copy(uint8_t *dst, const uint8_t *src, size_t len)
+{
+    uint8_t *end = dst + len;
+
+    do
+    {
+        copy32(dst, src);
+        dst += 32;
+        src += 32;
+    } while (dst < end);
+}
+
+// Copies a back-reference of len bytes from dist bytes behind dst, writing up
+// to 31 bytes past dst + len.
+static inline void wild_copy_match(uint8_t *dst, size_t dist, size_t len)
+{
+    const uint8_t *ref = dst - dist;
+    uint8_t *end = dst + len;
+
+    if (dist >= 32)
+    {
+        wild_copy(dst, ref, len);
+    }
+    else if (dist >= 16)
+    {
+        do
+        {
+            copy16(dst, ref);
+            dst += 16;
+            ref += 16;
+        } while (dst < end);
+    }
+    else if (dist == 1)
+    {
+        memset(dst, ref[0], len);
+    }
+    else
+    {
+        // Short overlapping match: the output repeats the last dist bytes, so
+        // fill a 16-byte pattern once and store it every whole period.
+        uint8_t pattern[16];
+        size_t filled = dist;
+        size_t step = 16 - 16 % dist;
+
+        memcpy(pattern, ref, dist);
+        while (filled < 16)
+        {
+            size_t n = filled < 16 - filled ? filled : 16 - filled;
+            memcpy(pattern + filled, pattern, n);
+            filled += n;
+        }
+
+        do
+        {
+            copy16(dst, pattern);
+            dst += step;
+        } while (dst < end);
+    }
+}
+
+bool refpack_header(const uint8_t *in, size_t in_size, size_t *header_size, size_t *decompressed_size)
+{
+    if (!in || in_size < 2 || in[1] != 0xFB) return false;
+
+    // 0x80: sizes are 4 bytes instead of 3. 0x01: a compressed size precedes
+    // the decompressed size.
+    size_t field = (in[0] & 0x80) ? 4 : 3;
+    size_t size = 2 + field * ((in[0] & 0x01) ? 2 : 1);
+
+    if (in_size < size) return false;
+
+    const uint8_t *p = in + size - field;
+    size_t n = 0;
+
+    for (size_t i = 0; i < field; i++)
+    {
+        n = (n << 8) | p[i];
+    }
+
+    *header_size = size;
+    *decompressed_size = n;
+    return true;
+}
+
+ptrdiff_t refpack_decompress(const uint8_t *in, size_t in_size, uint8_t *out, size_t out_capacity)
+{
+    size_t header_size, decompressed_size;
+
+    if (!refpack_header(in, in_size, &header_size, &decompressed_size)) return -1;
+    if (decompressed_size > out_capacity) return -1;
+
+    const uint8_t *ip = in + header_size;
+    const uint8_t *in_end = in + in_size;
+    uint8_t *op = out;
+    uint8_t *out_end = out + decompressed_size;
+
+    // Fast loop: only back-references need checking.
+    while (in_end - ip >= REFPACK_FAST_IN && out_end - op >= REFPACK_FAST_OUT)
+    {
+        size_t lit, len, dist;
+        uint8_t b0 = ip[0];
+
+        if (!(b0 & 0x80))
+        {
+            lit = b0 & 0x03;
+            len = ((b0 >> 2) & 0x07) + 3;
+            dist = ((b0 & 0x60) << 3) + ip[1] + 1;
+            ip += 2;
+        }
+        else if (!(b0 & 0x40))
+        {
+            lit = ip[1] >> 6;
+            len = (b0 & 0x3F) + 4;
+            dist = ((ip[1] & 0x3F) << 8) + ip[2] + 1;
+            ip += 3;
+        }
+        else if (!(b0 & 0x20))
+        {
+            lit = b0 & 0x03;
+            len = ((b0 & 0x0C) << 6) + ip[3] + 5;
+            dist = ((b0 & 0x10) << 12) + (ip[1] << 8) + ip[2] + 1;
+            ip += 4;
+        }
+        else
+        {
+            // Leave the stop command to the checked loop below.
+            if (b0 >= 0xFC) break;
+
+            lit = (b0 & 0x1F) * 4 + 4;
+            wild_copy(op, ip + 1, lit);
+            ip += 1 + lit;
+            op += lit;
+            continue;
+        }
+
+        copy4(op, ip);
+        ip += lit;
+        op += lit;
+
+        if (dist > (size_t)(op - out)) return -1;
+
+        if (len <= 16 && dist >= 16) copy16(op, op - dist);
+        else wild_copy_match(op, dist, len);
+        op += len;
+    }
+
+    // Checked loop for the last commands, where every copy is exact.
+    for (;;)
+    {
+        size_t lit, len, dist;
+        bool stop = false;
+
+        if (ip >= in_end) return -1;
+
+        uint8_t b0 = ip[0];
+
+        if (!(b0 & 0x80))
+        {
+            // 2-byte command: 0DDRRRPP DDDDDDDD
+            if (in_end - ip < 2) return -1;
+            lit = b0 & 0x03;
+            len = ((b0 >> 2) & 0x07) + 3;
+            dist = ((b0 & 0x60) << 3) + ip[1] + 1;
+            ip += 2;
+        }
+        else if (!(b0 & 0x40))
+        {
+            // 3-byte command: 10RRRRRR PPDDDDDD DDDDDDDD
+            if (in_end - ip < 3) return -1;
+            lit = ip[1] >> 6;
+            len = (b0 & 0x3F) + 4;
+            dist = ((ip[1] & 0x3F) << 8) + ip[2] + 1;
+            ip += 3;
+        }
+        else if (!(b0 & 0x20))
+        {
+            // 4-byte command: 110DRRPP DDDDDDDD DDDDDDDD RRRRRRRR
+            if (in_end - ip < 4) return -1;
+            lit = b0 & 0x03;
+            len = ((b0 & 0x0C) << 6) + ip[3] + 5;
+            dist = ((b0 & 0x10) << 12) + (ip[1] << 8) + ip[2] + 1;
+            ip += 4;
+        }
+        else
+        {
+            // 1-byte command: 111PPPPP, literals only. 0xFC-0xFF ends the stream.
+            lit = (b0 & 0x1F) * 4 + 4;
+            len = 0;
+            dist = 0;
+            ip += 1;
+
+            if (lit > 0x70)
+            {
+                lit = b0 & 0x03;
+                stop = true;
+            }
+        }
+
+        size_t in_left = in_end - ip;
+        size_t out_left = out_end - op;
+
+        if (lit > in_left || lit + len > out_left) return -1;
+
+        if (lit)
+        {
+            if (in_left >= lit + REFPACK_SLACK && out_left >= lit + REFPACK_SLACK) wild_copy(op, ip, lit);
+            else memcpy(op, ip, lit);
+
+            ip += lit;
+            op += lit;
+            out_left -= lit;
+        }
+
+        if (stop) break;
+        if (!len) continue;
+
+        if (dist > (size_t)(op - out)) return -1;
+
+        if (out_left >= len + REFPACK_SLACK)
+        {
+            wild_copy_match(op, dist, len);
+            op += len;
+        }
+        else
+        {
+            // Near the end of the output; copy exactly, byte by byte since
+            // the source may overlap what is being written.
+            const uint8_t *ref = op - dist;
+            for (size_t i = 0; i < len; i++) op[i] = ref[i];
+            op += len;
+        }
+    }
+
+    return op - out;
+}
+
+#define REFPACK_WINDOW    131072
+#define REFPACK_MIN_MATCH 3
+#define REFPACK_MAX_MATCH 1028
+
+typedef struct RefPackLevel {
+    int chainDepth;      // Candidates tried per position.
+    size_t niceLength;   // Stop searching once a match is this long.
+    bool lazy;           // Try a longer match one byte later before taking one.
+} RefPackLevel;
+
+static const RefPackLevel refpackLevels[] = {
+    [REFPACK_FAST]     = { 4, 32, false },
+    [REFPACK_BALANCED] = { 32, 128, true },
+    [REFPACK_MAX]      = { 1024, REFPACK_MAX_MATCH, true },
+};
+
+typedef struct RefPackEncoder {
+    const uint8_t *in;
+    size_t in_size;
+    uint8_t *op;
+    uint8_t *out_end;
+
+    int32_t *head;       // Latest position for each hash of 3 bytes, -1 if none.
+    int32_t *prev;       // Previous position with the same hash, per position.
+    unsigned int hash_shift;
+    size_t prev_mask;
+} RefPackEncoder;
+
+static inline uint32_t hash3(const uint8_t *p, unsigned int shift)
+{
+    return (((uint32_t)p[0] << 16) | (p[1] << 8) | p[2]) * 2654435761u >> shift;
+}
+
+static inline void insert_position(RefPackEncoder *enc, size_t pos)
+{
+    if (pos + REFPACK_MIN_MATCH > enc->in_size) return;
+
+    uint32_t h = hash3(enc->in + pos, enc->hash_shift);
+    enc->prev[pos & enc->prev_mask] = enc->head[h];
+    enc->head[h] = pos;
+}
+
+// Whether some command can encode a match of len bytes at distance dist.
+static inline bool match_encodable(size_t len, size_t dist)
+{
+    if (dist <= 1024) return len >= 3;
+    if (dist <= 16384) return len >= 4;
+    return len >= 5;
+}
+
+static inline size_t match_length(const uint8_t *a, const uint8_t *b, size_t max)
+{
+    size_t len = 0;
+
+    while (len + 8 <= max && !memcmp(a + len, b + len, 8)) len += 8;
+    while (len < max && a[len] == b[len]) len++;
+
+    return len;
+}
+
+static size_t find_match(RefPackEncoder *enc, const RefPackLevel *level, size_t pos, size_t *dist_out)
+{
+    size_t max_len = enc->in_size - pos;
+    if (max_len > REFPACK_MAX_MATCH) max_len = REFPACK_MAX_MATCH;
+    if (max_len < REFPACK_MIN_MATCH) return 0;
+
+    const uint8_t *cur = enc->in + pos;
+    int32_t cand = enc->head[hash3(cur, enc->hash_shift)];
+    size_t best = 0;
+
+    for (int depth = level->chainDepth; cand >= 0 && depth > 0; depth--)
+    {
+        size_t dist = pos - cand;
+        if (dist > REFPACK_WINDOW) break;
+
+        const uint8_t *ref = enc->in + cand;
+
+        // Only a match longer than the best so far is interesting.
+        if (ref[best] == cur[best])
+        {
+            size_t len = match_length(ref, cur, max_len);
+
+            if (len > best && match_encodable(len, dist))
+            {
+                best = len;
+                *dist_out = dist;
+                if (len >= level->niceLength || len == max_len) break;
+            }
+        }
+
+        cand = enc->prev[cand & enc->prev_mask];
+    }
+
+    return best;
+}
+
+// Emits 1-byte literal commands until fewer than 4 literals are left, and
+// returns how many are; those ride along with the next command.
+static bool emit_literal_runs(RefPackEncoder *enc, const uint8_t **lit, size_t *count)
+{
+    while (*count >= 4)
+    {
+        size_t run = *count & ~(size_t)3;
+        if (run > 112) run = 112;
+
+        if ((size_t)(enc->out_end - enc->op) < 1 + run) return false;
+
+        *enc->op++ = 0xE0 | (run / 4 - 1);
+        memcpy(enc->op, *lit, run);
+        enc->op += run;
+        *lit += run;
+        *count -= run;
+    }
+
+    return true;
+}
+
+static bool emit_match(RefPackEncoder *enc, const uint8_t *lit, size_t lit_count, size_t len, size_t dist)
+{
+    if (!emit_literal_runs(enc, &lit, &lit_count)) return false;
+    if ((size_t)(enc->out_end - enc->op) < 4 + lit_count) return false;
+
+    size_t d = dist - 1;
+    uint8_t *op = enc->op;
+
+    if (dist <= 1024 && len <= 10)
+    {
+        // 0DDRRRPP DDDDDDDD
+        *op++ = ((d >> 3) & 0x60) | ((len - 3) << 2) | lit_count;
+        *op++ = d;
+    }
+    else if (dist <= 16384 && len <= 67)
+    {
+        // 10RRRRRR PPDDDDDD DDDDDDDD
+        *op++ = 0x80 | (len - 4);
+        *op++ = (lit_count << 6) | (d >> 8);
+        *op++ = d;
+    }
+    else
+    {
+        // 110DRRPP DDDDDDDD DDDDDDDD RRRRRRRR
+        *op++ = 0xC0 | ((d >> 12) & 0x10) | (((len - 5) >> 6) & 0x0C) | lit_count;
+        *op++ = d >> 8;
+        *op++ = d;
+        *op++ = len - 5;
+    }
+
+    memcpy(op, lit, lit_count);
+    enc->op = op + lit_count;
+
+    return true;
+}
+
+static bool emit_end(RefPackEncoder *enc, const uint8_t *lit, size_t lit_count)
+{
+    if (!emit_literal_runs(enc, &lit, &lit_count)) return false;
+    if ((size_t)(enc->out_end - enc->op) < 1 + lit_count) return false;
+
+    *enc->op++ = 0xFC | lit_count;
+    memcpy(enc->op, lit, lit_count);
+    enc->op += lit_count;
+
+    return true;
+}
+
+size_t refpack_compress_bound(size_t in_size)
+{
+    // Header, every byte as a literal with one command per 112, and the stop command.
+    return 2 + 4 + in_size + in_size / 112 + 1 + 3;
+}
+
+ptrdiff_t refpack_compress(const uint8_t *in, size_t in_size, uint8_t *out, size_t out_capacity, int level)
+{
+    if (level < REFPACK_FAST || level > REFPACK_MAX) level = REFPACK_BALANCED;
+    if (in_size > UINT32_MAX) return -1;
+
+    const RefPackLevel *params = &refpackLevels[level];
+    RefPackEncoder enc = { .in = in, .in_size = in_size, .op = out, .out_end = out + out_capacity };
+
+    // Sizes above 24 bits need the 4-byte size field.
+    size_t field = in_size > 0xFFFFFF ? 4 : 3;
+    if (out_capacity < 2 + field) return -1;
+
+    *enc.op++ = field == 4 ? 0x90 : 0x10;
+    *enc.op++ = 0xFB;
+    for (size_t i = field; i > 0; i--) *enc.op++ = in_size >> (8 * (i - 1));
+
+    // Size the tables to the input so small entries stay cheap.
+    unsigned int hash_bits = 10;
+    while (hash_bits < 17 && ((size_t)1 << hash_bits) < in_size) hash_bits++;
+
+    size_t prev_size = 1;
+    while (prev_size < in_size && prev_size < REFPACK_WINDOW) prev_size <<= 1;
+
+    enc.hash_shift = 32 - hash_bits;
+    enc.prev_mask = prev_size - 1;
+    enc.head = malloc(sizeof(int32_t) << hash_bits);
+    enc.prev = malloc(sizeof(int32_t) * prev_size);
+    memset(enc.head, -1, sizeof(int32_t) << hash_bits);
+
+    size_t pos = 0;
+    size_t lit_start = 0;
+    bool ok = true;
+
+    while (ok && pos + REFPACK_MIN_MATCH <= in_size)
+    {
+        size_t dist;
+        size_t len = find_match(&enc, params, pos, &dist);
+        insert_position(&enc, pos);
+
+        if (!len)
+        {
+            pos++;
+            continue;
+        }
+
+        while (params->lazy && len < params->niceLength)
+        {
+            size_t next_dist;
+            size_t next_len = find_match(&enc, params, pos + 1, &next_dist);
+            if (next_len <= len) break;
+
+            // The match starting one byte later is longer; take this byte as a literal.
+            pos++;
+            insert_position(&enc, pos);
+            len = next_len;
+            dist = next_dist;
+        }
+
+        ok = emit_match(&enc, in + lit_start, pos - lit_start, len, dist);
+
+        for (size_t i = pos + 1; i < pos + len; i++) insert_position(&enc, i);
+        pos += len;
+        lit_start = pos;
+    }
+
+    if (ok) ok = emit_end(&enc, in + lit_start, in_size - lit_start);
+
+    free(enc.head);
+    free(enc.prev);
+
+    return ok ? enc.op - out : -1;
+}
+
+/**
+ * @brief Decompress a RefPack bitstream
+ * @param indata - (optional) Pointer to the input RefPack bitstream; may be
+ *	NULL
+ * @param bytes_read_out - (optional) Pointer to a size_t which will be filled
+ *	with the total number of bytes read from the RefPack bitstream; may be
+ *	NULL
+ * @param outdata - Pointer to the output buffer which will be filled with the
+ *	decompressed data; outdata may be NULL only if indata is also NULL
+ * @return The value of the "decompressed size" field in the RefPack bitstream,
+ *	or 0 if indata is NULL
+ *
+ * This function is a verbatim translation from x86 assembly into C (with
+ * new names and comments supplied) of the RefPack decompression function
+ * located at TSOServiceClientD_base+0x724fd in The Sims Online New & Improved
+ * Trial.
+ *
+ * This function ***does not*** perform any bounds-checking on reading or
+ * writing. It is inappropriate to use this function on untrusted data obtained
+ * from the internet (even though that is exactly what The Sims Online does...).
+ * Here are the potential problems:
+ * - This function will read past the end of indata if the last command in
+ *   indata tells it to.
+ * - This function will write past the end of outdata if indata tells it to.
+ * - This function will read before the beginning of outdata if indata tells
+ *   it to.
+ */
+size_t refpack_decompress_unsafe(const uint8_t *indata, size_t *bytes_read_out,
+	uint8_t *outdata)
+{
+	const uint8_t *in_ptr;
+	uint8_t *out_ptr;
+	uint16_t signature;
+	uint32_t decompressed_size = 0;
+	uint8_t byte_0, byte_1, byte_2, byte_3;
+	uint32_t proc_len, ref_len;
+	uint8_t *ref_ptr;
+	uint32_t i;
+ 
+	in_ptr = indata, out_ptr = outdata;
+	if (!in_ptr)
+		goto done;
+ 
+	signature = ((in_ptr[0] << 8) | in_ptr[1]), in_ptr += 2;
+	if (signature & 0x0100)
+		in_ptr += 3; /* skip over the compressed size field */
+ 
+	decompressed_size = ((in_ptr[0] << 16) | (in_ptr[1] << 8) | in_ptr[2]);
+	in_ptr += 3;
+ 
+	while (1) {
+		byte_0 = *in_ptr++;
+		if (!(byte_0 & 0x80)) {
+			/* 2-byte command: 0DDRRRPP DDDDDDDD */
+			byte_1 = *in_ptr++;
+ 
+			proc_len = byte_0 & 0x03;
+			for (i = 0; i < proc_len; i++)
+				*out_ptr++ = *in_ptr++;
+ 
+			ref_ptr = out_ptr - ((byte_0 & 0x60) << 3) - byte_1 - 1;
+			ref_len = ((byte_0 >> 2) & 0x07) + 3;
+			for (i = 0; i < ref_len; i++)
+				*out_ptr++ = *ref_ptr++;
+		} else if(!(byte_0 & 0x40)) {
+			/* 3-byte command: 10RRRRRR PPDDDDDD DDDDDDDD */
+			byte_1 = *in_ptr++;
+			byte_2 = *in_ptr++;
+ 
+			proc_len = byte_1 >> 6;
+			for (i = 0; i < proc_len; i++)
+				*out_ptr++ = *in_ptr++;
+ 
+			ref_ptr = out_ptr - ((byte_1 & 0x3f) << 8) - byte_2 - 1;
+			ref_len = (byte_0 & 0x3f) + 4;
+			for (i = 0; i < ref_len; i++)
+				*out_ptr++ = *ref_ptr++;
+		} else if(!(byte_0 & 0x20)) {
+			/* 4-byte command: 110DRRPP DDDDDDDD DDDDDDDD RRRRRRRR*/
+			byte_1 = *in_ptr++;
+			byte_2 = *in_ptr++;
+			byte_3 = *in_ptr++;
+ 
+			proc_len = byte_0 & 0x03;
+			for (i = 0; i < proc_len; i++)
+				*out_ptr++ = *in_ptr++;
+ 
+			ref_ptr = out_ptr - ((byte_0 & 0x10) << 12)
+				- (byte_1 << 8) - byte_2 - 1;
+			ref_len = ((byte_0 & 0x0c) << 6) + byte_3 + 5;
+			for (i = 0; i < ref_len; i++)
+				*out_ptr++ = *ref_ptr++;
+		} else {
+			/* 1-byte command: 111PPPPP */
+			proc_len = (byte_0 & 0x1f) * 4 + 4;
+			if (proc_len <= 0x70) {
+				/* no stop flag */
+				for (i = 0; i < proc_len; i++)
+					*out_ptr++ = *in_ptr++;
+			} else {
+				/* stop flag */
+				proc_len = byte_0 & 0x3;
+				for (i = 0; i < proc_len; i++)
+					*out_ptr++ = *in_ptr++;
+ 
+				break;
+			}
+		}
+	}
+ 
+done:
+	if (bytes_read_out)
+		*bytes_read_out = in_ptr - indata;
+	return decompressed_size;
+}
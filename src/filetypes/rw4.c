@@ -5,6 +5,7 @@
 #include <stdlib.h>
 #include <cpl_endian.h>
 #include "memstream.h"
+#include "threadpool.h"
 
 // All of this adapted from
 // SporeModder-FX
@@ -209,6 +210,49 @@ unsigned char *LoadSectionData(RWSectionInfo *sectionInfos, int section, const c
     return sectionInfos[section].dataOffset + initData;
 }
 
+// Vertices or indices per chunk when a buffer is split across threads.
+#define RW4_VERTEX_GRAIN 8192
+
+// Magic, DDS_HEADER and its DDS_PIXELFORMAT, as written in LoadRW4Data.
+#define DDS_HEADER_SIZE 128
+
+typedef struct VertexCopyArgs {
+    const unsigned char *vertices;
+    int vertexSize;
+    int positionOffset, normalOffset, texcoordOffset;
+    float *positions, *normals, *texcoords;
+} VertexCopyArgs;
+
+static void vertexcycle(int begin, int end, void *ctx)
+{
+    VertexCopyArgs *args = ctx;
+
+    for (int k = begin; k < end; k++)
+    {
+        const unsigned char *vertex = args->vertices + k * args->vertexSize;
+
+        memcpy(&args->positions[k*3], vertex + args->positionOffset, 3 * sizeof(float));
+        memcpy(&args->normals[k*3], vertex + args->normalOffset, 3 * sizeof(float));
+        memcpy(&args->texcoords[k*2], vertex + args->texcoordOffset, 2 * sizeof(float));
+    }
+}
+
+typedef struct IndexCopyArgs {
+    const uint16_t *src;
+    uint16_t *dst;
+    uint16_t bias;      // startIndex - firstVertex, applied mod 2^16 like before.
+} IndexCopyArgs;
+
+static void indexcycle(int begin, int end, void *ctx)
+{
+    IndexCopyArgs *args = ctx;
+
+    for (int k = begin; k < end; k++)
+    {
+        args->dst[k] = args->src[k] + args->bias;
+    }
+}
+
 Mesh LoadMeshRW4(RWMesh rwmesh, unsigned char *data, RWSectionInfo *sectionInfos, const unsigned char *initData)
 {
     Mesh mesh = { 0 };
@@ -259,30 +303,12 @@ Mesh LoadMeshRW4(RWMesh rwmesh, unsigned char *data, RWSectionInfo *sectionInfos
         float *normals   = malloc(3 * vertexCount * sizeof(float));
         float *texcoords = malloc(2 * vertexCount * sizeof(float));
 
-        for (int k = 0; k < vertexCount; k++)
-        {
-            vertexData = vertexInitData + ((vertexStart+k) * vertexBuffer->vertexSize + positionElement->offset);
-            positions[k*3+0] = *(float*)vertexData;
-            vertexData += sizeof(float);
-            positions[k*3+1] = *(float*)vertexData;
-            vertexData += sizeof(float);
-            positions[k*3+2] = *(float*)vertexData;
-            vertexData += sizeof(float);
-
-            vertexData = vertexInitData + ((vertexStart+k) * vertexBuffer->vertexSize + normalElement->offset);
-            normals[k*3+0] = *(float*)vertexData;
-            vertexData += sizeof(float);
-            normals[k*3+1] = *(float*)vertexData;
-            vertexData += sizeof(float);
-            normals[k*3+2] = *(float*)vertexData;
-            vertexData += sizeof(float);
-
-            vertexData = vertexInitData + ((vertexStart+k) * vertexBuffer->vertexSize + texcoordElement->offset);
-            texcoords[k*2+0] = *(float*)vertexData;
-            vertexData += sizeof(float);
-            texcoords[k*2+1] = *(float*)vertexData;
-            vertexData += sizeof(float);
-        }
+        VertexCopyArgs args = {
+            vertexInitData + vertexStart * vertexBuffer->vertexSize, vertexBuffer->vertexSize,
+            positionElement->offset, normalElement->offset, texcoordElement->offset,
+            positions, normals, texcoords,
+        };
+        ParallelFor(0, vertexCount, RW4_VERTEX_GRAIN, vertexcycle, &args);
 
         mesh.vertices = positions;
         mesh.normals = normals;
@@ -294,32 +320,14 @@ Mesh LoadMeshRW4(RWMesh rwmesh, unsigned char *data, RWSectionInfo *sectionInfos
     {
         RWIndexBuffer *indexBuffer = (RWIndexBuffer*)LoadSectionData(sectionInfos, rwmesh.indexBuffer, initData, NULL);
 
-        int indexComponents = 1;
-        //if (!mesh.normals) indexComponents = 2;
-
         uint16_t *indices = malloc(mesh.triangleCount * 3 * sizeof(uint16_t));
         unsigned char *indexData = LoadSectionData(sectionInfos, indexBuffer->indexData, initData, NULL);
 
-        data = indexData + rwmesh.firstIndex * 2;
-        
-        for (int j = 0; j < mesh.triangleCount-1; j++)
-        {
-            for (int k = 0; k < 3; k++)
-            {
-                uint16_t index = *(uint16_t*)data;
-                data += sizeof(uint16_t);
-
-                index += indexBuffer->startIndex;
-                index -= rwmesh.firstVertex;
-
-                indices[j*indexComponents*3 + indexComponents*k] = index;
-                //indices[j*indexComponents*3 + indexComponents*k + 1] = index;
-                //if (mesh.normals)
-                //{
-                //    indices[j*indexComponents*3 + indexComponents*k + 2] = index;
-                //}
-            }
-        }
+        IndexCopyArgs args = {
+            (uint16_t *)(indexData + rwmesh.firstIndex * 2), indices,
+            indexBuffer->startIndex - rwmesh.firstVertex,
+        };
+        ParallelFor(0, (mesh.triangleCount - 1) * 3, RW4_VERTEX_GRAIN, indexcycle, &args);
 
         mesh.indices = indices;
     }
@@ -327,17 +335,31 @@ Mesh LoadMeshRW4(RWMesh rwmesh, unsigned char *data, RWSectionInfo *sectionInfos
     return mesh;
 }
 
+// Everything from the section's data to the end of the file; sizes are not
+// trusted for the fixed-size records. Out of range sections read as zeros.
+static MemStream LoadSectionReader(MemStream *stream, RWSectionInfo sectionInfo)
+{
+    return memstream_subspan(stream, sectionInfo.dataOffset, stream->size - sectionInfo.dataOffset);
+}
+
+// Little-endian like the records, which are read straight into the structs.
 RW4Data LoadRW4Data(unsigned char *data, int dataSize)
 {
     RW4Data rw4data = { 0 };
 
-    const unsigned char *initData = data;
+    MemStream stream = memstream_read_create(data, dataSize);
 
     TRACELOG(LOG_DEBUG, "RW4 Info:\n");
 
     RWHeader header = { 0 };
-    memcpy(&header, data, sizeof(RWHeader));
-    data += sizeof(RWHeader);
+    memstream_read(&stream, &header, sizeof(RWHeader));
+
+    if (stream.error)
+    {
+        TRACELOG(LOG_ERROR, "RW4 header is truncated.\n");
+        rw4data.corrupted = true;
+        return rw4data;
+    }
 
     header.sectionCount &= 0xFF;
 
@@ -362,23 +384,23 @@ RW4Data LoadRW4Data(unsigned char *data, int dataSize)
     TRACELOG(LOG_DEBUG, "Offset 3: %d\n", header.offset3);
     TRACELOG(LOG_DEBUG, "Offset 4: %d\n", header.offset4);
 
-    data = initData + header.offset3;
-    RWSectionSubReferences *subRefs = (RWSectionSubReferences*)data;
+    RWSectionSubReferences subRefs;
+    MemStream subRefStream = memstream_subspan(&stream, header.offset3, sizeof(RWSectionSubReferences));
+    memstream_read(&subRefStream, &subRefs, sizeof(RWSectionSubReferences));
     TRACELOG(LOG_DEBUG, "Subreference info:\n");
-    TRACELOG(LOG_DEBUG, "Count: %d\n", subRefs->count);
-    TRACELOG(LOG_DEBUG, "Offset: %d\n", subRefs->offset);
+    TRACELOG(LOG_DEBUG, "Count: %d\n", subRefs.count);
+    TRACELOG(LOG_DEBUG, "Offset: %d\n", subRefs.offset);
 
     rw4data.corrupted = true;
 
     RWSectionInfo *sectionInfos = malloc(sizeof(RWSectionInfo) * header.sectionCount);
 
     TRACELOG(LOG_DEBUG, "Section info:\n");
-    data = initData + header.sectionInfoOffset;
+    memstream_seek(&stream, header.sectionInfoOffset);
     for (int i = 0; i < header.sectionCount; i++)
     {
         RWSectionInfo sectionInfo = { 0 };
-        memcpy(&sectionInfo, data, sizeof(RWSectionInfo));
-        data += sizeof(RWSectionInfo);
+        memstream_read(&stream, &sectionInfo, sizeof(RWSectionInfo));
 
         TRACELOG(LOG_DEBUG, "\nSection %d:\n", i);
         TRACELOG(LOG_DEBUG, "Data Offset: %d\n", sectionInfo.dataOffset);
@@ -396,9 +418,16 @@ RW4Data LoadRW4Data(unsigned char *data, int dataSize)
         sectionInfos[i] = sectionInfo;
     }
 
+    if (stream.error)
+    {
+        TRACELOG(LOG_ERROR, "RW4 section info is truncated.\n");
+        free(sectionInfos);
+        return rw4data;
+    }
+
     for (int i = 0; i < header.sectionCount; i++) {
         RWSectionInfo sectionInfo = sectionInfos[i];
-        data = initData + sectionInfo.dataOffset;
+        MemStream section = LoadSectionReader(&stream, sectionInfo);
 
         TRACELOG(LOG_DEBUG, "\nSection %d:\n", i);
 
@@ -407,7 +436,7 @@ RW4Data LoadRW4Data(unsigned char *data, int dataSize)
             case 0x70001: // KeyframeAnim
             {
                 RWKeyframeAnim keyframeAnim;
-                memcpy(&keyframeAnim, data, sizeof(RWKeyframeAnim));
+                memstream_read(&section, &keyframeAnim, sizeof(RWKeyframeAnim));
 
                 TRACELOG(LOG_DEBUG, "Keyframe Anim Info:\n");
                 TRACELOG(LOG_DEBUG, "Channel name offset: %d\n", keyframeAnim.channelNameOffset);
@@ -422,26 +451,22 @@ RW4Data LoadRW4Data(unsigned char *data, int dataSize)
             } break;
             case 0xff0001: // Animations
             {
-                data += sizeof(uint32_t);
-                uint32_t count = *(uint32_t*)data;
-                data += sizeof(uint32_t);
+                memstream_skip(&section, sizeof(uint32_t));
+                uint32_t count = memstream_read_le32(&section);
 
                 TRACELOG(LOG_DEBUG, "Animations Info:\n");
                 TRACELOG(LOG_DEBUG, "Count: %d\n", count);
-                for (int i = 0; i < count; i++)
+                for (uint32_t i = 0; i < count && !section.error; i++)
                 {
-                    uint32_t animationIndex = *(uint32_t*)data;
-                    data += sizeof(uint32_t);
-                    uint32_t section = *(uint32_t*)data;
-                    data += sizeof(uint32_t);
-                    TRACELOG(LOG_DEBUG, "Animation %#x: [Section %d]\n", animationIndex, section);
+                    uint32_t animationIndex = memstream_read_le32(&section);
+                    uint32_t animationSection = memstream_read_le32(&section);
+                    TRACELOG(LOG_DEBUG, "Animation %#x: [Section %d]\n", animationIndex, animationSection);
                 }
             } break;
             case 0x70002: // Skeleton
             {
                 RWSkeleton skeleton;
-                memcpy(&skeleton, data, sizeof(RWSkeleton));
-                data += sizeof(RWSkeleton);
+                memstream_read(&section, &skeleton, sizeof(RWSkeleton));
 
                 TRACELOG(LOG_DEBUG, "Skeleton Info:\n");
                 TRACELOG(LOG_DEBUG, "Bone Flag Offset: %d\n", skeleton.boneFlagOffset);
@@ -454,8 +479,7 @@ RW4Data LoadRW4Data(unsigned char *data, int dataSize)
             case 0x7000b: // SkeletonsInK
             {
                 RWSkeletonsInK skeletonsink;
-                memcpy(&skeletonsink, data, sizeof(RWSkeletonsInK));
-                data += sizeof(RWSkeletonsInK);
+                memstream_read(&section, &skeletonsink, sizeof(RWSkeletonsInK));
 
                 TRACELOG(LOG_DEBUG, "SkeletonsInK Info:\n");
                 TRACELOG(LOG_DEBUG, "Array Offset: %d\n", skeletonsink.arrayOffset);
@@ -468,8 +492,7 @@ RW4Data LoadRW4Data(unsigned char *data, int dataSize)
             case 0x80005: // BBox
             {
                 RWBBox bbox;
-                memcpy(&bbox, data, sizeof(RWBBox));
-                data += sizeof(RWBBox);
+                memstream_read(&section, &bbox, sizeof(RWBBox));
 
                 TRACELOG(LOG_DEBUG, "Bounding Box Information:\n");
                 TRACELOG(LOG_DEBUG, "Min: {%f, %f, %f}\n", bbox.min.x, bbox.min.y, bbox.min.z);
@@ -480,8 +503,7 @@ RW4Data LoadRW4Data(unsigned char *data, int dataSize)
                 RWMesh rwmesh;
                 Mesh mesh = { 0 };
 
-                memcpy(&rwmesh, data, sizeof(RWMesh));
-                data += sizeof(RWMesh); 
+                memstream_read(&section, &rwmesh, sizeof(RWMesh));
                 
                 TRACELOG(LOG_DEBUG, "Mesh Info:\n");
                 TRACELOG(LOG_DEBUG, "Primitive Type: %d\n", rwmesh.primitiveType);
@@ -502,8 +524,7 @@ RW4Data LoadRW4Data(unsigned char *data, int dataSize)
             case 0x20005: // VertexBuffer
             {
                 RWVertexBuffer vertexBuffer;
-                memcpy(&vertexBuffer, data, sizeof(RWVertexBuffer));
-                data += sizeof(RWVertexBuffer);
+                memstream_read(&section, &vertexBuffer, sizeof(RWVertexBuffer));
 
                 TRACELOG(LOG_DEBUG, "Vertex Buffer Info:\n");
                 TRACELOG(LOG_DEBUG, "Vertex Description: [Section %d]\n", vertexBuffer.vertexDescription);
@@ -520,8 +541,7 @@ RW4Data LoadRW4Data(unsigned char *data, int dataSize)
             case 0x20007: // IndexBuffer
             {
                 RWIndexBuffer indexBuffer;
-                memcpy(&indexBuffer, data, sizeof(RWIndexBuffer));
-                data += sizeof(RWIndexBuffer);
+                memstream_read(&section, &indexBuffer, sizeof(RWIndexBuffer));
 
                 TRACELOG(LOG_DEBUG, "Index Buffer Info:\n");
                 TRACELOG(LOG_DEBUG, "DirectX Index Buffer: %d\n", indexBuffer.dxIndexBuffer);
@@ -534,9 +554,9 @@ RW4Data LoadRW4Data(unsigned char *data, int dataSize)
             } break;
             case 0x20004: // VertexDescription
             {
-                RWVertexDescription vertexDescription;
-                memcpy(&vertexDescription, data, sizeof(RWVertexDescription));
-                data += sizeof(RWVertexDescription);
+                // The elements follow right after the fields, in place of the pointer.
+                RWVertexDescription vertexDescription = { 0 };
+                memstream_read(&section, &vertexDescription, sizeof(RWVertexDescription) - sizeof(void*));
 
                 TRACELOG(LOG_DEBUG, "Vertex Description Info:\n");
                 TRACELOG(LOG_DEBUG, "DirectX Vertex Declaration: %d\n", vertexDescription.dxVertexDeclaration);
@@ -545,7 +565,7 @@ RW4Data LoadRW4Data(unsigned char *data, int dataSize)
                 TRACELOG(LOG_DEBUG, "Element Flags: %#x\n", vertexDescription.elementFlags);
 
                 vertexDescription.elements = malloc(sizeof(RWVertexElement) * vertexDescription.count);
-                memcpy(vertexDescription.elements, data, sizeof(RWVertexElement) * vertexDescription.count);
+                memstream_read(&section, vertexDescription.elements, sizeof(RWVertexElement) * vertexDescription.count);
 
                 for (int j = 0; j < vertexDescription.count; j++)
                 {
@@ -559,11 +579,13 @@ RW4Data LoadRW4Data(unsigned char *data, int dataSize)
                     TRACELOG(LOG_DEBUG, "Usage index: %d\n", element.usageIndex);
                     TRACELOG(LOG_DEBUG, "Type Code: %#x\n", element.typeCode);
                 }
+
+                free(vertexDescription.elements);
             } break;
             case 0x80003: // TriangleKDTreeProcedural
             {
                 RWTriangleKDTreeProcedural kdt;
-                memcpy(&kdt, data, sizeof(RWTriangleKDTreeProcedural));
+                memstream_read(&section, &kdt, sizeof(RWTriangleKDTreeProcedural));
 
                 TRACELOG(LOG_DEBUG, "TriangleKDTreeProcedural info:\n");
                 TRACELOG(LOG_DEBUG, "Triangle count: %d\n", kdt.triangleCount);
@@ -578,17 +600,15 @@ RW4Data LoadRW4Data(unsigned char *data, int dataSize)
             case 0x2001a: // MeshCompiledStateLink
             {
                 RWMeshCompiledStateLink csl;
-                memcpy(&csl, data, sizeof(RWMeshCompiledStateLink));
-                data += sizeof(RWMeshCompiledStateLink);
+                memstream_read(&section, &csl, sizeof(RWMeshCompiledStateLink));
 
                 TRACELOG(LOG_DEBUG, "MeshCompiledStateLink info:\n");
                 TRACELOG(LOG_DEBUG, "Mesh: [Section %d]\n", csl.mesh);
                 TRACELOG(LOG_DEBUG, "Count: %d\n", csl.count);
 
-                for (int j = 0; j < csl.count; j++)
+                for (int j = 0; j < csl.count && !section.error; j++)
                 {
-                    int32_t compiledState = *(int32_t*)data;
-                    data += sizeof(int32_t);
+                    int32_t compiledState = memstream_read_le32(&section);
 
                     TRACELOG(LOG_DEBUG, "Compiled State %d: [Section %d]\n", j, compiledState);
                 } 
@@ -596,8 +616,7 @@ RW4Data LoadRW4Data(unsigned char *data, int dataSize)
             case 0x2000b: //CompiledState
             {
                 RWCompiledState compiledState;
-                memcpy(&compiledState, data, sizeof(RWCompiledState));
-                data += sizeof(RWCompiledState);
+                memstream_read(&section, &compiledState, sizeof(RWCompiledState));
 
                 const int FLAG_MODELTOWORLD       = 0x000001;
                 const int FLAG_SHADER_DATA        = 0x000008;
@@ -624,13 +643,11 @@ RW4Data LoadRW4Data(unsigned char *data, int dataSize)
                     rw4data.corrupted = true;
                 }
 
-                RWVertexDescription *vertexDescription;
-
                 if (compiledState.flags1 & FLAG_VERTEX_DESCRIPTION)
                 {
-                    vertexDescription = (RWVertexDescription*)data;
-                    data += sizeof(RWVertexDescription) - sizeof(void*);
-                    data += sizeof(RWVertexElement) * vertexDescription->count;
+                    RWVertexDescription vertexDescription = { 0 };
+                    memstream_read(&section, &vertexDescription, sizeof(RWVertexDescription) - sizeof(void*));
+                    memstream_skip(&section, sizeof(RWVertexElement) * vertexDescription.count);
                 }
 
                 if (compiledState.flags1 & FLAG_MATERIAL_COLOR)
@@ -653,7 +670,7 @@ RW4Data LoadRW4Data(unsigned char *data, int dataSize)
 
                 if (compiledState.flags1 & FLAG_USE_BOOLEANS)
                 {
-                    data += 17; // 17 unknown booleans
+                    memstream_skip(&section, 17); // 17 unknown booleans
                 }
 
                 if (compiledState.flags1 & 0xF0000)
@@ -674,8 +691,7 @@ RW4Data LoadRW4Data(unsigned char *data, int dataSize)
                     rw4data.corrupted = true;
                 }
 
-                int32_t paletteEntriesIndex = *(int32_t*)data;
-                data += sizeof(int32_t);
+                int32_t paletteEntriesIndex = memstream_read_le32(&section);
 
                 if (compiledState.flags3 & FLAG3_PALETTE_ENTRIES)
                 {
@@ -685,18 +701,15 @@ RW4Data LoadRW4Data(unsigned char *data, int dataSize)
 
                 if (compiledState.flags3 & FLAG3_TEXTURE_SLOTS)
                 {
-                    int32_t samplerIndex = *(int32_t*)data;
-                    data += sizeof(int32_t);
+                    int32_t samplerIndex = memstream_read_le32(&section);
 
                     TRACELOG(LOG_DEBUG, "Texture Slot info:\n");
 
-                    while (samplerIndex != -1)
+                    while (samplerIndex != -1 && !section.error)
                     {
-                        int32_t raster = *(int32_t*)data;
-                        data += sizeof(int32_t);
+                        int32_t raster = memstream_read_le32(&section);
                         
-                        int32_t stageStatesMask = *(int32_t*)data;
-                        data += sizeof(int32_t);
+                        int32_t stageStatesMask = memstream_read_le32(&section);
 
                         TRACELOG(LOG_DEBUG, "Sampler Index: %d\n", samplerIndex);
                         TRACELOG(LOG_DEBUG, "Raster: [Section %#x]\n", raster);
@@ -704,42 +717,34 @@ RW4Data LoadRW4Data(unsigned char *data, int dataSize)
 
                         if (stageStatesMask)
                         {
-                            int32_t state = *(int32_t*)data;
-                            data += sizeof(int32_t);
+                            int32_t state = memstream_read_le32(&section);
 
-                            while (state != -1)
+                            while (state != -1 && !section.error)
                             {
-                                int unkn = *(int32_t*)data;
-                                data += sizeof(int32_t);
+                                int unkn = memstream_read_le32(&section);
 
                                 // clogs output
                                 //TRACELOG(LOG_DEBUG, "State=%#x, data=%#x\n", state, unkn);
                                 
-                                state = *(int32_t*)data;
-                                data += sizeof(int32_t);
+                                state = memstream_read_le32(&section);
                             }
                         }
 
-                        int32_t samplerStatesMask = *(int32_t*)data;
-                        data += sizeof(int32_t);
+                        int32_t samplerStatesMask = memstream_read_le32(&section);
 
                         if (samplerStatesMask)
                         {
-                            int state = *(int32_t*)data;
-                            data += sizeof(int32_t);
+                            int state = memstream_read_le32(&section);
 
-                            while (state != -1)
+                            while (state != -1 && !section.error)
                             {
-                                int unkn = *(int32_t*)data;
-                                data += sizeof(int32_t);
+                                int unkn = memstream_read_le32(&section);
 
-                                state = *(int32_t*)data;
-                                data += sizeof(int32_t);
+                                state = memstream_read_le32(&section);
                             }
                         }
 
-                        samplerIndex = *(int32_t*)data;
-                        data += sizeof(int32_t);
+                        samplerIndex = memstream_read_le32(&section);
                     }
                 }
 
@@ -747,8 +752,7 @@ RW4Data LoadRW4Data(unsigned char *data, int dataSize)
             case 0x20003: // Raster
             {
                 RWRaster raster;
-                memcpy(&raster, data, sizeof(RWRaster));
-                data += sizeof(RWRaster);
+                memstream_read(&section, &raster, sizeof(RWRaster));
 
                 TRACELOG(LOG_DEBUG, "Raster info:\n");
                 TRACELOG(LOG_DEBUG, "Texture Format: %d\n", raster.textureFormat);
@@ -772,11 +776,28 @@ RW4Data LoadRW4Data(unsigned char *data, int dataSize)
                 {
                     TRACELOG(LOG_ERROR, "Invalid size.\n");
                     rw4data.corrupted = true;
+                    free(sectionInfos);
                     return rw4data;
                 }
 
-                int textureDataSize;
-                unsigned char *textureData = LoadSectionData(sectionInfos, raster.textureData, initData, &textureDataSize);
+                if (raster.textureData < 0 || (uint32_t)raster.textureData >= header.sectionCount)
+                {
+                    TRACELOG(LOG_ERROR, "Invalid texture data section %d.\n", raster.textureData);
+                    rw4data.corrupted = true;
+                    break;
+                }
+
+                MemStream texture = memstream_subspan(&stream, sectionInfos[raster.textureData].dataOffset, sectionInfos[raster.textureData].size);
+
+                if (texture.error)
+                {
+                    TRACELOG(LOG_ERROR, "Texture data lies outside of the file.\n");
+                    rw4data.corrupted = true;
+                    break;
+                }
+
+                unsigned char *textureData = texture.buf;
+                int textureDataSize = texture.size;
 
                 int blockSize = 0;
                 int rgbBitCount = 0;
@@ -809,23 +830,39 @@ RW4Data LoadRW4Data(unsigned char *data, int dataSize)
                     rw4data.corrupted = true;
                 }
 
-                int pitchOrLinearSize = 0;
+#define max(x, y) (((x)>(y))?(x):(y))
+                // Size of the top level, computed wide since width and height come from the file.
+                int64_t levelSize = 0;
 
                 if (blockSize == 0)
                 {
-                    pitchOrLinearSize = raster.width * raster.height * rgbBitCount / 8;
+                    levelSize = (int64_t)raster.width * raster.height * rgbBitCount / 8;
                 }
                 else
                 {
-#define max(x, y) (((x)>(y))?(x):(y))
-                    pitchOrLinearSize = max(1, ((raster.width + 3) / 4) * max(1, (raster.height + 3) / 4)) * blockSize;
-                    if (raster.textureFormat == 0x74)
-                    {
-                        pitchOrLinearSize = raster.width * raster.height * raster.volumeDepth * blockSize;
-                    }
+                    levelSize = max(1, (int64_t)((raster.width + 3) / 4) * max(1, (raster.height + 3) / 4)) * blockSize;
                     isCompressed = true;
                 }
 
+                if (levelSize > textureDataSize)
+                {
+                    TRACELOG(LOG_ERROR, "Texture data is truncated.\n");
+                    rw4data.corrupted = true;
+                    break;
+                }
+
+                int pitchOrLinearSize = levelSize;
+
+                if (raster.textureFormat == 0x74)
+                {
+                    pitchOrLinearSize = (int64_t)raster.width * raster.height * raster.volumeDepth * blockSize;
+                }
+
+                // raylib reads the mipmaps after the top level, or guesses their
+                // size as half of it, without knowing how much data there is.
+                // What it could read past the texture is zeroed instead.
+                int slack = levelSize / 2 + raster.mipmapLevels * blockSize;
+
                 int fourCC = 0;
 
                 if (isCompressed)
@@ -834,7 +871,8 @@ RW4Data LoadRW4Data(unsigned char *data, int dataSize)
                     fourCC = raster.textureFormat;
                 }
 
-                MemStream ddsStream = { 0 };
+                // One allocation for the header and the texture.
+                MemStream ddsStream = memstream_create(DDS_HEADER_SIZE + textureDataSize + slack);
 
                 char padding[256] = { 0 }; // 0-filled padding
 
@@ -869,9 +907,16 @@ RW4Data LoadRW4Data(unsigned char *data, int dataSize)
                 // DDS Data
                 memstream_write(&ddsStream, textureData, textureDataSize);
 
+                for (int n; slack > 0; slack -= n)
+                {
+                    n = slack < (int)sizeof(padding) ? slack : (int)sizeof(padding);
+                    memstream_write(&ddsStream, padding, n);
+                }
+
                 SaveFileData("rw4_out.dds", ddsStream.buf, ddsStream.size);
 
                 Image img = LoadImageFromMemory(".dds", ddsStream.buf, ddsStream.size);
+                memstream_free(&ddsStream);
                 
                 if (rw4data.type == RW4_TEXTURE)
                 {
@@ -897,5 +942,7 @@ RW4Data LoadRW4Data(unsigned char *data, int dataSize)
         }
     }
 
+    free(sectionInfos);
+
     return rw4data;
 }
@@ -1,9 +1,14 @@
 #include <filetypes/package.h>
+#include <filetypes/pkgcache.h>
+#include <filetypes/pkgdedup.h>
+#include <resmgr.h>
 #include <cpl_raylib.h>
 #include <stdlib.h>
 #include <cpl_pthread.h>
 #include <threadpool.h>
 
+#define INDEX_CACHE_FILENAME "opensc5_index.cache"
+
 static int compar_alphabetize(const void *p1, const void *p2)
 {
     const char *s1 = *(const char **)p1;
@@ -22,15 +27,16 @@ static int compar_alphabetize(const void *p1, const void *p2)
 typedef struct LoadPackageFileAsyncArgs {
     FILE *f;
     Package *pkg;
+    TaskGroup group;
     bool done;
 } LoadPackageFileAsyncArgs;
 
 static void *loadPackageFile_async(void *param)
 {
     LoadPackageFileAsyncArgs *args = param;
-    args->done = false;
-    *args->pkg = LoadPackageFile(args->f);
-    args->done = true;
+    *args->pkg = LoadPackageFileInGroup(args->f, PKGLOAD_LAZY, &args->group);
+    __atomic_store_n(&args->done, true, __ATOMIC_RELEASE);
+    return NULL;
 }
 
 int main(int argc, char **argv)
@@ -55,43 +61,88 @@ int main(int argc, char **argv)
 
     PropertyNameList propNames = LoadPropertyNameList(TextFormat("%s/Config/Properties.txt", argv[1]));
 
-    Package allGameData = { 0 };
+    ResourceManager resources = { 0 };
 
     SetTraceLogLevel(LOG_INFO);
     InitWindow(1280, 720, "OpenSC5 Launcher");
     SetWriteCorruptedPackageEntries(false);
+    // The packages overlap, so identical entries are decoded once.
+    SetDeduplicatePackageEntries(true);
+
+    const char **packagePaths = malloc(sizeof(char *) * simcityData.count);
+    int packageCount = 0;
+
+    for (unsigned int i = 0; i < simcityData.count; i++)
+    {
+        if (IsFileExtension(simcityData.paths[i], ".package")) packagePaths[packageCount++] = simcityData.paths[i];
+    }
+
+    // When the cache holds exactly these packages, unchanged, they are opened
+    // from it with their keys already merged. Otherwise the packages that
+    // still match it skip reading their index, and it is written again.
+    PackageCache cache = LoadPackageCache(INDEX_CACHE_FILENAME);
+    bool cacheStale = !IsPackageCacheCurrent(cache, packagePaths, packageCount) || !LoadCachedResources(&resources, &cache);
 
-    for (int i = 0; i < simcityData.count; i++)
+    const char **loadedPaths = malloc(sizeof(char *) * packageCount);
+    Package *loadedPkgs = malloc(sizeof(Package) * packageCount);
+    int loadedCount = 0;
+
+    // Packages load in name order, so later ones override earlier ones.
+    for (int i = 0; i < packageCount && cacheStale; i++)
     {
-        if (!IsFileExtension(simcityData.paths[i], ".package")) continue;
-        printf("Loading %s...\n", simcityData.paths[i]);
-        FILE *f = fopen(simcityData.paths[i], "r");
+        int cached = FindCachedPackage(cache, packagePaths[i]);
+        if (cached != -1)
+        {
+            Package pkg = LoadCachedPackage(cache, cached, packagePaths[i]);
+            if (IsFileMapped(pkg.mapping))
+            {
+                AddResourceLayer(&resources, pkg, packagePaths[i]);
+                loadedPaths[loadedCount] = packagePaths[i];
+                loadedPkgs[loadedCount++] = pkg;
+                continue;
+            }
+        }
+
+        printf("Loading %s...\n", packagePaths[i]);
+        FILE *f = fopen(packagePaths[i], "r");
         if (!f)
         {
-            perror(simcityData.paths[i]);
+            perror(packagePaths[i]);
             continue;
         }
         pthread_t thread;
-        LoadPackageFileAsyncArgs args;
-        args.done = false;
-        args.f = f;
         Package pkg;
-        args.pkg = &pkg;
+        LoadPackageFileAsyncArgs args = { .f = f, .pkg = &pkg, .group = NewTaskGroup(GetSharedThreadpool()) };
         pthread_create(&thread, NULL, loadPackageFile_async, &args);
-        while (!args.done)
+        while (!__atomic_load_n(&args.done, __ATOMIC_ACQUIRE))
         {
             BeginDrawing();
             ClearBackground(RAYWHITE);
-            DrawText(TextFormat("%s: %d left.\n", simcityData.paths[i], GetThreadpoolTasksLeft()), 0, 0, 20, BLACK);
+            DrawText(TextFormat("%s: %d left.\n", packagePaths[i], GetTaskGroupTasksLeft(&args.group)), 0, 0, 20, BLACK);
             EndDrawing();
         }
         pthread_join(thread, NULL);
-        printf("Merging package into game...\n");
-        MergePackages(&allGameData, pkg);
+        AddResourceLayer(&resources, pkg, packagePaths[i]);
+        loadedPaths[loadedCount] = packagePaths[i];
+        loadedPkgs[loadedCount++] = pkg;
         fclose(f);
     }
 
-    printf("Loaded %d package entries.\n", allGameData.entryCount);
+    UnloadPackageCache(cache);
+
+    if (cacheStale)
+    {
+        SavePackageCache(INDEX_CACHE_FILENAME, loadedPaths, loadedPkgs, loadedCount);
+    }
+
+    free(loadedPaths);
+    free(loadedPkgs);
+    free(packagePaths);
+
+    printf("Loaded %u resources from %d packages.\n", resources.resourceCount, resources.layerCount);
+
+    UnloadResourceManager(&resources);
+    CloseSharedThreadpool();
 
     return 0;
 }
@@ -0,0 +1,124 @@
+#include "filetypes/prop.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Writes src/filetypes/propnames.c and include/filetypes/propnames.h: the
+// property names from Properties.txt and the PKGENTRY_* type names from
+// package.h, hashed and sorted by id, so nothing is parsed at startup.
+// Run from the top directory after changing either file.
+
+#define GENERATED_NOTICE "// Generated by gen_propnames from %s and %s. Do not edit.\n"
+
+typedef struct TypeName {
+    unsigned int id;
+    char name[32];
+} TypeName;
+
+static int CompareTypeNames(const void *a, const void *b)
+{
+    const TypeName *x = a, *y = b;
+
+    if (x->id != y->id) return x->id < y->id ? -1 : 1;
+    return strcmp(x->name, y->name);
+}
+
+// Only the hex defines; the PKGENTRY_LOADED and friends states are decimal.
+static TypeName *LoadTypeNames(const char *filename, int *count)
+{
+    FILE *f = fopen(filename, "r");
+    TypeName *types = NULL;
+    char buf[1024];
+
+    *count = 0;
+
+    if (!f)
+    {
+        perror(filename);
+        return NULL;
+    }
+
+    while (fgets(buf, sizeof(buf), f))
+    {
+        TypeName type = { 0 };
+
+        if (sscanf(buf, "#define PKGENTRY_%31[A-Z0-9_] 0x%x", type.name, &type.id) != 2) continue;
+
+        types = realloc(types, sizeof(TypeName) * (*count + 1));
+        types[(*count)++] = type;
+    }
+
+    fclose(f);
+
+    qsort(types, *count, sizeof(TypeName), CompareTypeNames);
+
+    return types;
+}
+
+int main(int argc, char **argv)
+{
+    const char *propFile = argc > 1 ? argv[1] : "Properties.txt";
+    const char *typeFile = argc > 2 ? argv[2] : "include/filetypes/package.h";
+    const char *sourceFile = argc > 3 ? argv[3] : "src/filetypes/propnames.c";
+    const char *headerFile = argc > 4 ? argv[4] : "include/filetypes/propnames.h";
+
+    PropertyNameList props = LoadPropertyNameList(propFile);
+    int typeCount;
+    TypeName *types = LoadTypeNames(typeFile, &typeCount);
+
+    if (!props.propCount || !typeCount)
+    {
+        fprintf(stderr, "Nothing to generate.\n");
+        return 1;
+    }
+
+    FILE *h = fopen(headerFile, "w");
+    FILE *c = fopen(sourceFile, "w");
+
+    if (!h || !c)
+    {
+        perror("Cannot write the output");
+        return 1;
+    }
+
+    fprintf(h, GENERATED_NOTICE "\n", propFile, typeFile);
+    fprintf(h, "#ifndef _PROPNAMES_\n#define _PROPNAMES_\n\n");
+
+    for (int i = 0; i < props.propCount; i++) fprintf(h, "#define PROP_%s 0x%08lx\n", props.propNames[i], props.propIds[i]);
+
+    fprintf(h, "\n#define BUILTIN_PROP_COUNT %d\n", props.propCount);
+    fprintf(h, "#define BUILTIN_TYPE_COUNT %d\n\n", typeCount);
+    fprintf(h, "// Sorted by id.\n");
+    fprintf(h, "extern const unsigned long builtinPropIds[BUILTIN_PROP_COUNT];\n");
+    fprintf(h, "extern const char *const builtinPropNames[BUILTIN_PROP_COUNT];\n");
+    fprintf(h, "extern const unsigned int builtinTypeIds[BUILTIN_TYPE_COUNT];\n");
+    fprintf(h, "extern const char *const builtinTypeNames[BUILTIN_TYPE_COUNT];\n\n");
+    fprintf(h, "#endif\n");
+
+    fprintf(c, GENERATED_NOTICE "\n", propFile, typeFile);
+    fprintf(c, "#include \"filetypes/propnames.h\"\n\n");
+
+    fprintf(c, "const unsigned long builtinPropIds[BUILTIN_PROP_COUNT] = {\n");
+    for (int i = 0; i < props.propCount; i++) fprintf(c, "    0x%08lx,\n", props.propIds[i]);
+    fprintf(c, "};\n\n");
+
+    fprintf(c, "const char *const builtinPropNames[BUILTIN_PROP_COUNT] = {\n");
+    for (int i = 0; i < props.propCount; i++) fprintf(c, "    \"%s\",\n", props.propNames[i]);
+    fprintf(c, "};\n\n");
+
+    fprintf(c, "const unsigned int builtinTypeIds[BUILTIN_TYPE_COUNT] = {\n");
+    for (int i = 0; i < typeCount; i++) fprintf(c, "    0x%08x,\n", types[i].id);
+    fprintf(c, "};\n\n");
+
+    fprintf(c, "const char *const builtinTypeNames[BUILTIN_TYPE_COUNT] = {\n");
+    for (int i = 0; i < typeCount; i++) fprintf(c, "    \"%s\",\n", types[i].name);
+    fprintf(c, "};\n");
+
+    fclose(h);
+    fclose(c);
+    free(types);
+
+    printf("%d properties and %d types written to %s and %s\n", props.propCount, typeCount, sourceFile, headerFile);
+
+    return 0;
+}
@@ -1,33 +1,217 @@
 #include "hash.h"
 #include <string.h>
-#include<ctype.h>
 
-char *strlwr(char *str)
-{
-  unsigned char *p = (unsigned char *)str;
+#define FNV_OFFSET 0x811C9DC5
+#define FNV_PRIME 0x1000193
+
+// ASCII only, like tolower in the C locale. A table lookup is cheaper than
+// the range check in the hashing loops.
+#define LOWER1(c) ((c) >= 'A' && (c) <= 'Z' ? (c) + 32 : (c))
+#define LOWER4(c) LOWER1(c), LOWER1(c + 1), LOWER1(c + 2), LOWER1(c + 3)
+#define LOWER16(c) LOWER4(c), LOWER4(c + 4), LOWER4(c + 8), LOWER4(c + 12)
+#define LOWER64(c) LOWER16(c), LOWER16(c + 16), LOWER16(c + 32), LOWER16(c + 48)
 
-  while (*p) {
-     *p = tolower((unsigned char)*p);
-      p++;
-  }
+static const unsigned char lowerTable[256] = { LOWER64(0), LOWER64(64), LOWER64(128), LOWER64(192) };
 
-  return str;
+// Stays a char so bytes above 0x7F are mixed in sign-extended where char is
+// signed, as they always were.
+static inline char LowerChar(char c)
+{
+	return lowerTable[(unsigned char)c];
 }
 
 // Adapted from https://simswiki.info/wiki.php?title=Spore:HashVal
-unsigned long TheHash(char *strptr) {
-	char oname[1024];
-	unsigned int hash;
-	char *p;
-
-	strcpy(&oname[0], strptr);
-	strlwr(&oname[0]);
-	hash = 0x811C9DC5;
-	p=&oname[0];
-	while(*p) {
-		hash *= 0x1000193;
-		hash ^= (*p);
-		p++;
+unsigned long TheHash(const char *str)
+{
+	uint32_t hash = FNV_OFFSET;
+
+	for (; *str; str++) hash = hash * FNV_PRIME ^ LowerChar(*str);
+
+	return hash;
+}
+
+unsigned long TheHashLength(const char *str, size_t length)
+{
+	uint32_t hash = FNV_OFFSET;
+
+	for (size_t i = 0; i < length; i++) hash = hash * FNV_PRIME ^ LowerChar(str[i]);
+
+	return hash;
+}
+
+// Four names at a time: each hash is a serial chain of multiplies, so
+// interleaving independent ones keeps the multiplier busy. A lane that runs
+// out of characters takes the next name, so ragged lengths don't serialize.
+#define HASH_LANES 4
+
+void TheHashBatch(const char *const *strs, const size_t *lengths, int count, uint32_t *hashes)
+{
+	const char *p[HASH_LANES];
+	size_t left[HASH_LANES];
+	uint32_t h[HASH_LANES];
+	int owner[HASH_LANES];
+	int next = 0;
+
+	if (count < HASH_LANES)
+	{
+		for (int i = 0; i < count; i++) hashes[i] = lengths ? TheHashLength(strs[i], lengths[i]) : TheHash(strs[i]);
+		return;
+	}
+
+	for (int k = 0; k < HASH_LANES; k++)
+	{
+		p[k] = strs[next];
+		left[k] = lengths ? lengths[next] : strlen(strs[next]);
+		h[k] = FNV_OFFSET;
+		owner[k] = next++;
+	}
+
+	for (;;)
+	{
+		size_t step = left[0];
+		for (int k = 1; k < HASH_LANES; k++) if (left[k] < step) step = left[k];
+
+		for (size_t j = 0; j < step; j++)
+		{
+			h[0] = h[0] * FNV_PRIME ^ LowerChar(p[0][j]);
+			h[1] = h[1] * FNV_PRIME ^ LowerChar(p[1][j]);
+			h[2] = h[2] * FNV_PRIME ^ LowerChar(p[2][j]);
+			h[3] = h[3] * FNV_PRIME ^ LowerChar(p[3][j]);
+		}
+
+		for (int k = 0; k < HASH_LANES; k++)
+		{
+			p[k] += step;
+			left[k] -= step;
 		}
-	return(hash);
+
+		for (int k = 0; k < HASH_LANES; k++)
+		{
+			if (left[k]) continue;
+
+			hashes[owner[k]] = h[k];
+
+			// Out of names: finish the other lanes one at a time.
+			if (next == count)
+			{
+				for (int o = 0; o < HASH_LANES; o++)
+				{
+					if (o == k) continue;
+					for (size_t j = 0; j < left[o]; j++) h[o] = h[o] * FNV_PRIME ^ LowerChar(p[o][j]);
+					hashes[owner[o]] = h[o];
+				}
+				return;
+			}
+
+			p[k] = strs[next];
+			left[k] = lengths ? lengths[next] : strlen(strs[next]);
+			h[k] = FNV_OFFSET;
+			owner[k] = next++;
+		}
+	}
+}
+
+#define XXH_PRIME64_1 0x9E3779B185EBCA87ULL
+#define XXH_PRIME64_2 0xC2B2AE3D27D4EB4FULL
+#define XXH_PRIME64_3 0x165667B19E3779F9ULL
+#define XXH_PRIME64_4 0x85EBCA77C2B2AE63ULL
+#define XXH_PRIME64_5 0x27D4EB2F165667C5ULL
+
+static uint64_t rotl64(uint64_t x, int r)
+{
+	return (x << r) | (x >> (64 - r));
+}
+
+// Unaligned little-endian loads; memcpy compiles down to a single move.
+static uint64_t read64(const unsigned char *p)
+{
+	uint64_t v;
+	memcpy(&v, p, sizeof(v));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+	v = __builtin_bswap64(v);
+#endif
+	return v;
+}
+
+static uint32_t read32(const unsigned char *p)
+{
+	uint32_t v;
+	memcpy(&v, p, sizeof(v));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+	v = __builtin_bswap32(v);
+#endif
+	return v;
+}
+
+static uint64_t xxh64_round(uint64_t acc, uint64_t input)
+{
+	acc += input * XXH_PRIME64_2;
+	acc = rotl64(acc, 31);
+	return acc * XXH_PRIME64_1;
+}
+
+static uint64_t xxh64_merge(uint64_t acc, uint64_t val)
+{
+	acc ^= xxh64_round(0, val);
+	return acc * XXH_PRIME64_1 + XXH_PRIME64_4;
+}
+
+// https://github.com/Cyan4973/xxHash/blob/dev/doc/xxhash_spec.md
+uint64_t HashData64(const void *data, size_t size)
+{
+	const unsigned char *p = data;
+	const unsigned char *end = p + size;
+	uint64_t hash;
+
+	if (size >= 32)
+	{
+		uint64_t v1 = XXH_PRIME64_1 + XXH_PRIME64_2;
+		uint64_t v2 = XXH_PRIME64_2;
+		uint64_t v3 = 0;
+		uint64_t v4 = -XXH_PRIME64_1;
+
+		do {
+			v1 = xxh64_round(v1, read64(p));
+			v2 = xxh64_round(v2, read64(p + 8));
+			v3 = xxh64_round(v3, read64(p + 16));
+			v4 = xxh64_round(v4, read64(p + 24));
+			p += 32;
+		} while (end - p >= 32);
+
+		hash = rotl64(v1, 1) + rotl64(v2, 7) + rotl64(v3, 12) + rotl64(v4, 18);
+		hash = xxh64_merge(hash, v1);
+		hash = xxh64_merge(hash, v2);
+		hash = xxh64_merge(hash, v3);
+		hash = xxh64_merge(hash, v4);
+	}
+	else hash = XXH_PRIME64_5;
+
+	hash += size;
+
+	for (; end - p >= 8; p += 8)
+	{
+		hash ^= xxh64_round(0, read64(p));
+		hash = rotl64(hash, 27) * XXH_PRIME64_1 + XXH_PRIME64_4;
+	}
+
+	if (end - p >= 4)
+	{
+		hash ^= read32(p) * XXH_PRIME64_1;
+		hash = rotl64(hash, 23) * XXH_PRIME64_2 + XXH_PRIME64_3;
+		p += 4;
+	}
+
+	for (; p < end; p++)
+	{
+		hash ^= *p * XXH_PRIME64_5;
+		hash = rotl64(hash, 11) * XXH_PRIME64_1;
+	}
+
+	hash ^= hash >> 33;
+	hash *= XXH_PRIME64_2;
+	hash ^= hash >> 29;
+	hash *= XXH_PRIME64_3;
+	hash ^= hash >> 32;
+
+	return hash;
 }
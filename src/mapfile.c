@@ -0,0 +1,88 @@
+#include "mapfile.h"
+#include <cpl_raylib.h>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+MappedFile MapFile(FILE *f)
+{
+    MappedFile map = { 0 };
+
+    if (!f) return map;
+
+#ifdef _WIN32
+    HANDLE file = (HANDLE)_get_osfhandle(_fileno(f));
+    LARGE_INTEGER size;
+
+    if (file == INVALID_HANDLE_VALUE || !GetFileSizeEx(file, &size) || size.QuadPart == 0) return map;
+
+    HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_WRITECOPY, 0, 0, NULL);
+    if (!mapping)
+    {
+        TRACELOG(LOG_WARNING, "CreateFileMapping failed (%lu).\n", GetLastError());
+        return map;
+    }
+
+    // The view keeps the mapping object alive on its own.
+    void *data = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+    CloseHandle(mapping);
+
+    if (!data)
+    {
+        TRACELOG(LOG_WARNING, "MapViewOfFile failed (%lu).\n", GetLastError());
+        return map;
+    }
+
+    map.data = data;
+    map.size = size.QuadPart;
+#else
+    struct stat st;
+
+    if (fstat(fileno(f), &st) == -1 || st.st_size == 0) return map;
+
+    void *data = mmap(NULL, st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fileno(f), 0);
+    if (data == MAP_FAILED)
+    {
+        perror("mmap");
+        return map;
+    }
+
+    map.data = data;
+    map.size = st.st_size;
+#endif
+
+    return map;
+}
+
+MappedFile MapFileFromPath(const char *filename)
+{
+    FILE *f = fopen(filename, "rb");
+
+    if (!f) return (MappedFile){ 0 };
+
+    // The mapping stays valid after the file is closed.
+    MappedFile map = MapFile(f);
+    fclose(f);
+
+    return map;
+}
+
+bool IsFileMapped(MappedFile map)
+{
+    return map.data != NULL;
+}
+
+void UnmapFile(MappedFile map)
+{
+    if (!map.data) return;
+
+#ifdef _WIN32
+    UnmapViewOfFile(map.data);
+#else
+    munmap(map.data, map.size);
+#endif
+}
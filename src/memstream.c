@@ -2,12 +2,81 @@
 #include <string.h>
 #include <stdlib.h>
 
+#define MEMSTREAM_MIN_CAPACITY 64
+
+MemStream memstream_create(int capacity)
+{
+    MemStream stream = { 0 };
+
+    memstream_reserve(&stream, capacity);
+
+    return stream;
+}
+
+MemStream memstream_create_in_arena(Arena *arena, int capacity)
+{
+    MemStream stream = { .arena = arena };
+
+    memstream_reserve(&stream, capacity);
+
+    return stream;
+}
+
+MemStream memstream_create_fixed(void *buf, int capacity)
+{
+    return (MemStream)
+    {
+        .buf = buf,
+        .cur = buf,
+        .capacity = capacity,
+        .fixed = true
+    };
+}
+
+bool memstream_reserve(MemStream *stream, int capacity)
+{
+    if (capacity <= stream->capacity) return true;
+    if (stream->fixed) return false;
+
+    if (stream->arena)
+    {
+        void *buf = ArenaAlloc(stream->arena, capacity);
+        if (stream->size) memcpy(buf, stream->buf, stream->size);
+        stream->buf = buf;
+    }
+    else stream->buf = realloc(stream->buf, capacity);
+
+    stream->cur = stream->buf;
+    stream->capacity = capacity;
+
+    return true;
+}
+
+void memstream_free(MemStream *stream)
+{
+    if (!stream->arena && !stream->fixed) free(stream->buf);
+
+    *stream = (MemStream){ .arena = stream->arena };
+}
+
 void memstream_write(MemStream *stream, void *buf, int size)
 {
-    int oldSize = stream->size;
+    if (stream->size + size > stream->capacity)
+    {
+        int capacity = stream->capacity * 2;
+
+        if (capacity < stream->size + size) capacity = stream->size + size;
+        if (capacity < MEMSTREAM_MIN_CAPACITY) capacity = MEMSTREAM_MIN_CAPACITY;
+
+        if (!memstream_reserve(stream, capacity))
+        {
+            stream->error = true;
+            size = stream->capacity - stream->size;
+        }
+    }
+
+    memcpy((unsigned char *)stream->buf + stream->size, buf, size);
     stream->size += size;
-    stream->buf = realloc(stream->buf, stream->size);
-    memcpy(stream->buf + oldSize, buf, size);
 }
 
 void memstream_writestream(MemStream *dest, MemStream *src)
@@ -38,11 +107,13 @@ MemStream memstream_read_create(unsigned char *data, int dataSize)
 int memstream_read(MemStream *stream, void *buf, int size)
 {
     int toRead = size;
-    int canRead = stream->size - (stream->cur - stream->buf);
+    int canRead = memstream_remaining(stream);
 
     if (canRead < toRead)
     {
         toRead = canRead;
+        memset((unsigned char *)buf + toRead, 0, size - toRead);
+        stream->error = true;
     }
 
     memcpy(buf, stream->cur, toRead);
@@ -52,6 +123,30 @@ int memstream_read(MemStream *stream, void *buf, int size)
     return toRead;
 }
 
+bool memstream_seek(MemStream *stream, int offset)
+{
+    if ((unsigned int)offset > (unsigned int)stream->size)
+    {
+        stream->cur = (unsigned char *)stream->buf + stream->size;
+        stream->error = true;
+        return false;
+    }
+
+    stream->cur = (unsigned char *)stream->buf + offset;
+    return true;
+}
+
+MemStream memstream_subspan(MemStream *stream, int offset, int size)
+{
+    if ((unsigned int)offset > (unsigned int)stream->size || (unsigned int)size > (unsigned int)(stream->size - offset))
+    {
+        stream->error = true;
+        return (MemStream){ .error = true };
+    }
+
+    return memstream_read_create((unsigned char *)stream->buf + offset, size);
+}
+
 #define memstream_read_impl_(bits) \
 uint##bits##_t memstream_read##bits(MemStream *stream) \
 { \
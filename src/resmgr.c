@@ -0,0 +1,252 @@
+#include "resmgr.h"
+#include "filetypes/pkgindex.h"
+#include <stdlib.h>
+#include <string.h>
+
+static bool SlotMatches(const ResourceSlot *slot, unsigned int type, unsigned int group, unsigned int instance)
+{
+    return slot->layer >= 0 && slot->instance == instance && slot->type == type && slot->group == group;
+}
+
+static ResourceSlot *LookupSlot(const ResourceManager *mgr, unsigned int type, unsigned int group, unsigned int instance)
+{
+    if (!mgr->slotCount) return NULL;
+
+    unsigned int mask = mgr->slotCount - 1;
+    unsigned int i = HashTGI(type, group, instance) & mask;
+
+    while (mgr->slots[i].layer != RESOURCE_SLOT_EMPTY)
+    {
+        if (SlotMatches(&mgr->slots[i], type, group, instance)) return &mgr->slots[i];
+        i = (i + 1) & mask;
+    }
+
+    return NULL;
+}
+
+static int CompareSlotKey(const ResourceSlot *slot, unsigned int type, unsigned int group, unsigned int instance)
+{
+    if (slot->type != type) return slot->type < type ? -1 : 1;
+    if (slot->group != group) return slot->group < group ? -1 : 1;
+    if (slot->instance != instance) return slot->instance < instance ? -1 : 1;
+    return 0;
+}
+
+static const ResourceSlot *LookupBaseSlot(const ResourceManager *mgr, unsigned int type, unsigned int group, unsigned int instance)
+{
+    unsigned int lo = 0, hi = mgr->baseCount;
+
+    while (lo < hi)
+    {
+        unsigned int mid = lo + (hi - lo) / 2;
+        int cmp = CompareSlotKey(&mgr->baseSlots[mid], type, group, instance);
+
+        if (!cmp) return &mgr->baseSlots[mid];
+        if (cmp < 0) lo = mid + 1;
+        else hi = mid;
+    }
+
+    return NULL;
+}
+
+// Layers added on top of the base are in the hash table, so it goes first.
+static const ResourceSlot *ResolveSlot(const ResourceManager *mgr, unsigned int type, unsigned int group, unsigned int instance)
+{
+    const ResourceSlot *slot = LookupSlot(mgr, type, group, instance);
+
+    return slot ? slot : LookupBaseSlot(mgr, type, group, instance);
+}
+
+// Points the key at (layer, entry), adding it if it is new.
+static void SetSlot(ResourceManager *mgr, unsigned int type, unsigned int group, unsigned int instance, int layer, int entry)
+{
+    unsigned int mask = mgr->slotCount - 1;
+    unsigned int i = HashTGI(type, group, instance) & mask;
+    ResourceSlot *reuse = NULL;
+
+    while (mgr->slots[i].layer != RESOURCE_SLOT_EMPTY)
+    {
+        ResourceSlot *slot = &mgr->slots[i];
+
+        if (SlotMatches(slot, type, group, instance))
+        {
+            slot->layer = layer;
+            slot->entry = entry;
+            return;
+        }
+
+        if (slot->layer == RESOURCE_SLOT_DELETED && !reuse) reuse = slot;
+        i = (i + 1) & mask;
+    }
+
+    if (!reuse)
+    {
+        reuse = &mgr->slots[i];
+        mgr->usedSlots++;
+    }
+
+    *reuse = (ResourceSlot){ type, group, instance, layer, entry };
+
+    // Keys overriding the base were already counted with it.
+    if (!LookupBaseSlot(mgr, type, group, instance)) mgr->resourceCount++;
+}
+
+// Rehashes when live and deleted slots would pass half the table.
+static void ReserveSlots(ResourceManager *mgr, unsigned int extra)
+{
+    if ((mgr->usedSlots + extra) * 2 <= mgr->slotCount) return;
+
+    ResourceSlot *old = mgr->slots;
+    unsigned int oldCount = mgr->slotCount;
+    unsigned int slotCount = 16;
+
+    while (slotCount < (mgr->resourceCount + extra) * 2) slotCount <<= 1;
+
+    mgr->slots = malloc(sizeof(ResourceSlot) * slotCount);
+    mgr->slotCount = slotCount;
+    mgr->resourceCount = mgr->baseCount;
+    mgr->usedSlots = 0;
+
+    for (unsigned int i = 0; i < slotCount; i++) mgr->slots[i].layer = RESOURCE_SLOT_EMPTY;
+
+    for (unsigned int i = 0; i < oldCount; i++)
+    {
+        if (old[i].layer >= 0) SetSlot(mgr, old[i].type, old[i].group, old[i].instance, old[i].layer, old[i].entry);
+    }
+
+    free(old);
+}
+
+int AddResourceLayer(ResourceManager *mgr, Package pkg, const char *name)
+{
+    int layer = mgr->layerCount++;
+
+    mgr->layers = realloc(mgr->layers, sizeof(ResourceLayer) * mgr->layerCount);
+    mgr->layers[layer] = (ResourceLayer){ pkg, strdup(name ? name : ""), true };
+
+    ReserveSlots(mgr, pkg.entryCount);
+
+    // The new layer is on top, so each of its keys wins; later entries within
+    // the package overwrite earlier ones.
+    for (unsigned int i = 0; i < pkg.entryCount; i++)
+    {
+        PackageEntry *entry = &pkg.entries[i];
+        SetSlot(mgr, entry->type, entry->group, entry->instance, layer, i);
+    }
+
+    return layer;
+}
+
+void AddResolvedResourceLayers(ResourceManager *mgr, const Package *pkgs, const char **names, int count,
+                               const ResourceSlot *table, unsigned int tableCount, MappedFile mapping)
+{
+    mgr->layers = malloc(sizeof(ResourceLayer) * count);
+    mgr->layerCount = count;
+
+    for (int i = 0; i < count; i++)
+    {
+        mgr->layers[i] = (ResourceLayer){ pkgs[i], strdup(names && names[i] ? names[i] : ""), true };
+    }
+
+    mgr->baseSlots = table;
+    mgr->baseCount = tableCount;
+    mgr->baseMapping = mapping;
+    mgr->resourceCount = tableCount;
+}
+
+// Moves the base into the hash table, which removing a layer updates in place.
+static void MergeBaseSlots(ResourceManager *mgr)
+{
+    const ResourceSlot *base = mgr->baseSlots;
+    unsigned int baseCount = mgr->baseCount;
+
+    if (!base) return;
+
+    ReserveSlots(mgr, baseCount);
+
+    mgr->baseSlots = NULL;
+    mgr->baseCount = 0;
+
+    for (unsigned int i = 0; i < baseCount; i++)
+    {
+        if (LookupSlot(mgr, base[i].type, base[i].group, base[i].instance)) continue;
+
+        SetSlot(mgr, base[i].type, base[i].group, base[i].instance, base[i].layer, base[i].entry);
+        mgr->resourceCount--; // Counted with the base already.
+    }
+
+    UnmapFile(mgr->baseMapping);
+    mgr->baseMapping = (MappedFile){ 0 };
+}
+
+void RemoveResourceLayer(ResourceManager *mgr, int layer)
+{
+    if (layer < 0 || layer >= mgr->layerCount || !mgr->layers[layer].active) return;
+
+    MergeBaseSlots(mgr);
+
+    Package pkg = mgr->layers[layer].pkg;
+
+    for (unsigned int i = 0; i < pkg.entryCount; i++)
+    {
+        PackageEntry *entry = &pkg.entries[i];
+        ResourceSlot *slot = LookupSlot(mgr, entry->type, entry->group, entry->instance);
+
+        if (!slot || slot->layer != layer) continue;
+
+        // No layer above could have had the key, so only look below.
+        slot->layer = RESOURCE_SLOT_DELETED;
+        for (int below = layer - 1; below >= 0; below--)
+        {
+            if (!mgr->layers[below].active) continue;
+
+            int found = FindPackageEntry(mgr->layers[below].pkg, entry->type, entry->group, entry->instance);
+            if (found != -1)
+            {
+                slot->layer = below;
+                slot->entry = found;
+                break;
+            }
+        }
+
+        if (slot->layer == RESOURCE_SLOT_DELETED) mgr->resourceCount--;
+    }
+
+    UnloadPackageFile(pkg);
+    free(mgr->layers[layer].name);
+    mgr->layers[layer] = (ResourceLayer){ 0 };
+}
+
+void UnloadResourceManager(ResourceManager *mgr)
+{
+    for (int i = 0; i < mgr->layerCount; i++)
+    {
+        if (!mgr->layers[i].active) continue;
+
+        UnloadPackageFile(mgr->layers[i].pkg);
+        free(mgr->layers[i].name);
+    }
+
+    free(mgr->layers);
+    free(mgr->slots);
+    UnmapFile(mgr->baseMapping);
+    *mgr = (ResourceManager){ 0 };
+}
+
+PackageEntry *FindResource(const ResourceManager *mgr, unsigned int type, unsigned int group, unsigned int instance)
+{
+    const ResourceSlot *slot = ResolveSlot(mgr, type, group, instance);
+
+    if (!slot) return NULL;
+
+    return &mgr->layers[slot->layer].pkg.entries[slot->entry];
+}
+
+PackageEntry *GetResourceData(const ResourceManager *mgr, unsigned int type, unsigned int group, unsigned int instance)
+{
+    const ResourceSlot *slot = ResolveSlot(mgr, type, group, instance);
+
+    if (!slot) return NULL;
+
+    return GetPackageEntryData(mgr->layers[slot->layer].pkg, slot->entry);
+}
@@ -1,8 +1,11 @@
 #include "threadpool.h"
 #include <cpl_pthread.h>
 #include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
 #include <cpl_raylib.h>
 #include <stdio.h>
+#include <string.h>
 
 #ifdef __linux__
 #include <sys/sysinfo.h>
@@ -10,40 +13,534 @@
 #include <sysinfoapi.h>
 #endif
 
-static pthread_t *threadpool;
-static int threadpoolCount;
+// Work-stealing scheduler. Every worker owns a Chase-Lev deque: it pushes and
+// pops at the bottom, idle workers steal from the top of a random victim.
+// Tasks submitted from outside the pool go through one locked injector queue,
+// which workers drain in batches into their own deques. High and idle priority
+// tasks have their own locked queues, checked before and after everything else.
 
 typedef struct ThreadpoolTask {
     void (*task)(void*);
     void *arg;
+    TaskGroup *group;
 } ThreadpoolTask;
 
-static ThreadpoolTask *tasks;
-static int taskCount;
-static pthread_mutex_t task_mutex;
-static bool running;
+typedef struct TaskBuffer {
+    int64_t capacity;       // Power of two.
+    struct TaskBuffer *retired; // Older buffers, freed with the pool since thieves may still read them.
+    ThreadpoolTask slots[];
+} TaskBuffer;
 
-void *threadpool_runner(void *__unused_arg)
+typedef struct Worker {
+    int64_t top;            // Thieves take from here.
+    char pad[56];           // Keep top and bottom on separate cache lines.
+    int64_t bottom;         // The owner pushes and pops here.
+    TaskBuffer *buffer;
+
+    Threadpool *pool;
+    pthread_t thread;
+    unsigned int rng;
+} Worker;
+
+// Submitted from outside the pool; a FIFO ring buffer that grows when full.
+typedef struct TaskQueue {
+    ThreadpoolTask *tasks;
+    unsigned int capacity;
+    unsigned int head;
+    unsigned int count;
+} TaskQueue;
+
+struct Threadpool {
+    Worker *workers;
+    int threadCount;
+
+    TaskQueue injector;
+    TaskQueue urgent;       // TASK_PRIORITY_HIGH
+    TaskQueue idle;         // TASK_PRIORITY_IDLE
+    int tasksInFlight;      // Queued plus running.
+    int sleepers;           // Workers waiting for tasks.
+    int waiters;            // Threads blocked in one of the waits.
+    pthread_mutex_t mutex;
+    pthread_cond_t task_available;
+    pthread_cond_t tasks_done; // Broadcast after each task while anyone is waiting.
+    bool running;
+};
+
+// Injected tasks a worker moves to its own deque per lock.
+#define INJECT_BATCH 32
+
+static __thread Worker *currentWorker;
+static __thread TaskGroup *currentGroup;
+
+static Threadpool *sharedPool;
+static pthread_mutex_t sharedPoolMutex = PTHREAD_MUTEX_INITIALIZER;
+
+static TaskBuffer *NewTaskBuffer(int64_t capacity)
+{
+    TaskBuffer *buffer = malloc(sizeof(TaskBuffer) + sizeof(ThreadpoolTask) * capacity);
+    buffer->capacity = capacity;
+    buffer->retired = NULL;
+    return buffer;
+}
+
+// Slots are read by thieves while the owner may be writing a wrapped-around
+// slot, so each field is accessed atomically; a torn read is discarded by the
+// failed CAS on top.
+static void StoreTask(TaskBuffer *buffer, int64_t i, ThreadpoolTask task)
+{
+    ThreadpoolTask *slot = &buffer->slots[i & (buffer->capacity - 1)];
+    __atomic_store_n(&slot->task, task.task, __ATOMIC_RELAXED);
+    __atomic_store_n(&slot->arg, task.arg, __ATOMIC_RELAXED);
+    __atomic_store_n(&slot->group, task.group, __ATOMIC_RELAXED);
+}
+
+static ThreadpoolTask LoadTask(TaskBuffer *buffer, int64_t i)
+{
+    ThreadpoolTask *slot = &buffer->slots[i & (buffer->capacity - 1)];
+    return (ThreadpoolTask){
+        __atomic_load_n(&slot->task, __ATOMIC_RELAXED),
+        __atomic_load_n(&slot->arg, __ATOMIC_RELAXED),
+        __atomic_load_n(&slot->group, __ATOMIC_RELAXED),
+    };
+}
+
+static void PushTask(Worker *worker, ThreadpoolTask task)
+{
+    int64_t b = __atomic_load_n(&worker->bottom, __ATOMIC_RELAXED);
+    int64_t t = __atomic_load_n(&worker->top, __ATOMIC_ACQUIRE);
+    TaskBuffer *buffer = __atomic_load_n(&worker->buffer, __ATOMIC_RELAXED);
+
+    if (b - t > buffer->capacity - 1)
+    {
+        TaskBuffer *grown = NewTaskBuffer(buffer->capacity * 2);
+
+        for (int64_t i = t; i < b; i++) StoreTask(grown, i, LoadTask(buffer, i));
+
+        grown->retired = buffer;
+        __atomic_store_n(&worker->buffer, grown, __ATOMIC_RELEASE);
+        buffer = grown;
+    }
+
+    StoreTask(buffer, b, task);
+
+    // Sequentially consistent so it orders against the sleepers check in
+    // WakeWorker as well as publishing the slot.
+    __atomic_store_n(&worker->bottom, b + 1, __ATOMIC_SEQ_CST);
+}
+
+static bool PopTask(Worker *worker, ThreadpoolTask *task)
+{
+    int64_t b = __atomic_load_n(&worker->bottom, __ATOMIC_RELAXED) - 1;
+    TaskBuffer *buffer = __atomic_load_n(&worker->buffer, __ATOMIC_RELAXED);
+
+    __atomic_store_n(&worker->bottom, b, __ATOMIC_SEQ_CST);
+
+    int64_t t = __atomic_load_n(&worker->top, __ATOMIC_SEQ_CST);
+    bool found = false;
+
+    if (t <= b)
+    {
+        *task = LoadTask(buffer, b);
+        found = true;
+
+        // Last task: race thieves for it.
+        if (t == b)
+        {
+            found = __atomic_compare_exchange_n(&worker->top, &t, t + 1, false, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED);
+            __atomic_store_n(&worker->bottom, b + 1, __ATOMIC_RELAXED);
+        }
+    }
+    else
+    {
+        __atomic_store_n(&worker->bottom, b + 1, __ATOMIC_RELAXED);
+    }
+
+    return found;
+}
+
+// Whether the task belongs to group or to one of its descendants. Only for
+// tasks that are still queued, so their groups are alive.
+static bool IsTaskInGroup(ThreadpoolTask task, TaskGroup *group)
+{
+    for (TaskGroup *g = task.group; g; g = g->parent)
+    {
+        if (g == group) return true;
+    }
+
+    return false;
+}
+
+// Pops the bottom task only if it belongs to group or its descendants. The
+// owner is the only one writing its slots, so the peeked task is the one
+// PopTask returns unless a thief takes it first.
+static bool PopGroupTask(Worker *worker, TaskGroup *group, ThreadpoolTask *task)
+{
+    int64_t b = __atomic_load_n(&worker->bottom, __ATOMIC_RELAXED);
+    int64_t t = __atomic_load_n(&worker->top, __ATOMIC_ACQUIRE);
+
+    if (t >= b) return false;
+    if (!IsTaskInGroup(LoadTask(__atomic_load_n(&worker->buffer, __ATOMIC_RELAXED), b - 1), group)) return false;
+
+    return PopTask(worker, task);
+}
+
+// Returns 1 on success, 0 if the deque looked empty and -1 if another thief won.
+// Given a group, only a task of exactly that group is taken: until the CAS
+// succeeds the slot may be stale, so its group is compared but never followed.
+static int StealTask(Worker *victim, TaskGroup *group, ThreadpoolTask *task)
+{
+    int64_t t = __atomic_load_n(&victim->top, __ATOMIC_SEQ_CST);
+    int64_t b = __atomic_load_n(&victim->bottom, __ATOMIC_SEQ_CST);
+
+    if (t >= b) return 0;
+
+    TaskBuffer *buffer = __atomic_load_n(&victim->buffer, __ATOMIC_ACQUIRE);
+    *task = LoadTask(buffer, t);
+
+    if (group && task->group != group) return 0;
+
+    if (!__atomic_compare_exchange_n(&victim->top, &t, t + 1, false, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED)) return -1;
+
+    return 1;
+}
+
+static void GrowQueue(TaskQueue *queue)
 {
+    unsigned int capacity = queue->capacity ? queue->capacity * 2 : 64;
+    ThreadpoolTask *grown = malloc(sizeof(ThreadpoolTask) * capacity);
+
+    // Unwrap the ring so the queue starts at index 0 again.
+    for (unsigned int i = 0; i < queue->count; i++)
+    {
+        grown[i] = queue->tasks[(queue->head + i) & (queue->capacity - 1)];
+    }
+
+    free(queue->tasks);
+    queue->tasks = grown;
+    queue->capacity = capacity;
+    queue->head = 0;
+}
+
+static ThreadpoolTask DequeueTask(TaskQueue *queue)
+{
+    ThreadpoolTask task = queue->tasks[queue->head];
+    queue->head = (queue->head + 1) & (queue->capacity - 1);
+    __atomic_sub_fetch(&queue->count, 1, __ATOMIC_RELAXED);
+    return task;
+}
+
+// Takes one task from a shared queue. Given a worker, up to INJECT_BATCH more
+// of the same group move onto its deque so the lock is taken once per batch
+// instead of once per task. Only the same group, so a thread waiting on
+// another group is never left with its tasks stuck behind these. This thread
+// runs one task at a time, so a sleeper is woken for each one it moved to
+// steal it from the deque.
+static bool TakeQueuedTask(Threadpool *pool, TaskQueue *queue, Worker *worker, ThreadpoolTask *task)
+{
+    if (!__atomic_load_n(&queue->count, __ATOMIC_RELAXED)) return false;
+
+    pthread_mutex_lock(&pool->mutex);
+
+    bool found = queue->count > 0;
+    if (found)
+    {
+        *task = DequeueTask(queue);
+
+        int moved = 0;
+        for (; worker && moved < INJECT_BATCH && queue->count && queue->tasks[queue->head].group == task->group; moved++)
+        {
+            PushTask(worker, DequeueTask(queue));
+        }
+
+        if (moved && pool->sleepers)
+        {
+            if (moved >= pool->sleepers) pthread_cond_broadcast(&pool->task_available);
+            else for (int i = 0; i < moved; i++) pthread_cond_signal(&pool->task_available);
+        }
+    }
+
+    pthread_mutex_unlock(&pool->mutex);
+
+    return found;
+}
+
+// Takes the oldest task of group or its descendants out of a shared queue.
+static bool TakeGroupTask(Threadpool *pool, TaskQueue *queue, TaskGroup *group, ThreadpoolTask *task)
+{
+    if (!__atomic_load_n(&queue->count, __ATOMIC_RELAXED)) return false;
+
+    pthread_mutex_lock(&pool->mutex);
+
+    bool found = false;
+    unsigned int mask = queue->capacity - 1;
+
+    for (unsigned int i = 0; i < queue->count && !found; i++)
+    {
+        if (!IsTaskInGroup(queue->tasks[(queue->head + i) & mask], group)) continue;
+
+        *task = queue->tasks[(queue->head + i) & mask];
+        found = true;
+
+        // Close the gap; the tasks in front of it move up by one.
+        for (; i > 0; i--) queue->tasks[(queue->head + i) & mask] = queue->tasks[(queue->head + i - 1) & mask];
+        DequeueTask(queue);
+    }
+
+    pthread_mutex_unlock(&pool->mutex);
+
+    return found;
+}
+
+static bool TrySteal(Threadpool *pool, Worker *self, TaskGroup *group, unsigned int *rng, ThreadpoolTask *task)
+{
+    bool contended = true;
+
+    while (contended)
+    {
+        contended = false;
+
+        // xorshift; start at a random victim and try each once.
+        *rng ^= *rng << 13;
+        *rng ^= *rng >> 17;
+        *rng ^= *rng << 5;
+
+        for (int i = 0; i < pool->threadCount; i++)
+        {
+            Worker *victim = &pool->workers[(*rng + i) % pool->threadCount];
+            if (victim == self) continue;
+
+            int result = StealTask(victim, group, task);
+            if (result == 1) return true;
+            if (result == -1) contended = true;
+        }
+    }
+
+    return false;
+}
+
+static bool FindTask(Threadpool *pool, Worker *self, unsigned int *rng, ThreadpoolTask *task)
+{
+    if (TakeQueuedTask(pool, &pool->urgent, NULL, task)) return true;
+    if (self && PopTask(self, task)) return true;
+    if (TakeQueuedTask(pool, &pool->injector, self, task)) return true;
+    if (TrySteal(pool, self, NULL, rng, task)) return true;
+    return TakeQueuedTask(pool, &pool->idle, NULL, task);
+}
+
+// FindTask for a thread waiting on group: only tasks of group and its
+// descendants, in the same order. A NULL group stands for every task.
+static bool FindGroupTask(Threadpool *pool, Worker *self, TaskGroup *group, unsigned int *rng, ThreadpoolTask *task)
+{
+    if (!group) return FindTask(pool, self, rng, task);
+
+    if (TakeGroupTask(pool, &pool->urgent, group, task)) return true;
+    if (self && PopGroupTask(self, group, task)) return true;
+    if (TakeGroupTask(pool, &pool->injector, group, task)) return true;
+    if (TrySteal(pool, self, group, rng, task)) return true;
+    return TakeGroupTask(pool, &pool->idle, group, task);
+}
+
+static bool HasQueuedTasks(Threadpool *pool)
+{
+    if (__atomic_load_n(&pool->injector.count, __ATOMIC_SEQ_CST)) return true;
+    if (__atomic_load_n(&pool->urgent.count, __ATOMIC_SEQ_CST)) return true;
+    if (__atomic_load_n(&pool->idle.count, __ATOMIC_SEQ_CST)) return true;
+
+    for (int i = 0; i < pool->threadCount; i++)
+    {
+        Worker *worker = &pool->workers[i];
+        if (__atomic_load_n(&worker->bottom, __ATOMIC_SEQ_CST) > __atomic_load_n(&worker->top, __ATOMIC_SEQ_CST)) return true;
+    }
+
+    return false;
+}
+
+// Called after a task becomes visible. Paired with the sleepers increment in
+// threadpool_runner so a worker going to sleep cannot miss it.
+static void WakeWorker(Threadpool *pool)
+{
+    if (__atomic_load_n(&pool->sleepers, __ATOMIC_SEQ_CST))
+    {
+        pthread_mutex_lock(&pool->mutex);
+        pthread_cond_signal(&pool->task_available);
+        pthread_mutex_unlock(&pool->mutex);
+    }
+}
+
+static void futurecycle(void *param)
+{
+    TaskFuture *future = param;
+
+    future->result = future->task(future->arg);
+    __atomic_store_n(&future->state, TASK_DONE, __ATOMIC_SEQ_CST);
+}
+
+// Runs the task unless its group was cancelled first.
+static void CallTask(ThreadpoolTask task)
+{
+    TaskGroup *previous = currentGroup;
+    currentGroup = task.group;
+
+    if (task.group && IsTaskGroupCancelled(task.group))
+    {
+        if (task.task == futurecycle) __atomic_store_n(&((TaskFuture *)task.arg)->state, TASK_CANCELLED, __ATOMIC_SEQ_CST);
+    }
+    else
+    {
+        task.task(task.arg);
+    }
+
+    currentGroup = previous;
+}
+
+static void RunTask(Threadpool *pool, ThreadpoolTask task)
+{
+    CallTask(task);
+
+    // The group may be gone as soon as its count reaches 0.
+    if (task.group) __atomic_sub_fetch(&task.group->pending, 1, __ATOMIC_SEQ_CST);
+    __atomic_sub_fetch(&pool->tasksInFlight, 1, __ATOMIC_SEQ_CST);
+
+    if (__atomic_load_n(&pool->waiters, __ATOMIC_SEQ_CST))
+    {
+        pthread_mutex_lock(&pool->mutex);
+        pthread_cond_broadcast(&pool->tasks_done);
+        pthread_mutex_unlock(&pool->mutex);
+    }
+}
+
+void *threadpool_runner(void *param)
+{
+    Worker *self = param;
+    Threadpool *pool = self->pool;
+    currentWorker = self;
+
     while (1)
     {
-        if (!taskCount)
+        ThreadpoolTask task;
+
+        if (FindTask(pool, self, &self->rng, &task))
         {
-            if (!running) return NULL;
-            WaitTime(1.0f/60);
+            RunTask(pool, task);
             continue;
         }
-        pthread_mutex_lock(&task_mutex);
-        ThreadpoolTask task = tasks[taskCount - 1];
-        taskCount--;
-        tasks = realloc(tasks, taskCount * sizeof(ThreadpoolTask));
-        pthread_mutex_unlock(&task_mutex);
 
-        task.task(task.arg);
+        pthread_mutex_lock(&pool->mutex);
+        __atomic_add_fetch(&pool->sleepers, 1, __ATOMIC_SEQ_CST);
+
+        while (pool->running && !HasQueuedTasks(pool))
+        {
+            pthread_cond_wait(&pool->task_available, &pool->mutex);
+        }
+
+        __atomic_sub_fetch(&pool->sleepers, 1, __ATOMIC_SEQ_CST);
+        bool stop = !pool->running && !HasQueuedTasks(pool);
+        pthread_mutex_unlock(&pool->mutex);
+
+        if (stop) break;
     }
+
+    currentWorker = NULL;
+    return NULL;
 }
 
-void InitThreadpool(int nproc)
+static void SubmitTask(Threadpool *pool, ThreadpoolTask task, int priority)
+{
+    __atomic_add_fetch(&pool->tasksInFlight, 1, __ATOMIC_RELAXED);
+
+    if (priority == TASK_PRIORITY_NORMAL && currentWorker && currentWorker->pool == pool)
+    {
+        PushTask(currentWorker, task);
+        WakeWorker(pool);
+        return;
+    }
+
+    TaskQueue *queue = &pool->injector;
+    if (priority == TASK_PRIORITY_HIGH) queue = &pool->urgent;
+    else if (priority == TASK_PRIORITY_IDLE) queue = &pool->idle;
+
+    pthread_mutex_lock(&pool->mutex);
+    if (queue->count == queue->capacity) GrowQueue(queue);
+    queue->tasks[(queue->head + queue->count) & (queue->capacity - 1)] = task;
+    __atomic_add_fetch(&queue->count, 1, __ATOMIC_SEQ_CST);
+    if (pool->sleepers) pthread_cond_signal(&pool->task_available);
+    if (pool->waiters) pthread_cond_broadcast(&pool->tasks_done);
+    pthread_mutex_unlock(&pool->mutex);
+}
+
+// Submits count tasks at once: one lock for the whole batch from outside the
+// pool, none from inside it.
+static void SubmitTaskBatch(Threadpool *pool, ThreadpoolTask task, void *args, size_t argSize, int count, int priority)
+{
+    if (count < 1) return;
+
+    __atomic_add_fetch(&pool->tasksInFlight, count, __ATOMIC_RELAXED);
+
+    if (priority == TASK_PRIORITY_NORMAL && currentWorker && currentWorker->pool == pool)
+    {
+        for (int i = 0; i < count; i++)
+        {
+            task.arg = (unsigned char *)args + i * argSize;
+            PushTask(currentWorker, task);
+        }
+
+        if (__atomic_load_n(&pool->sleepers, __ATOMIC_SEQ_CST))
+        {
+            pthread_mutex_lock(&pool->mutex);
+            pthread_cond_broadcast(&pool->task_available);
+            pthread_mutex_unlock(&pool->mutex);
+        }
+        return;
+    }
+
+    TaskQueue *queue = &pool->injector;
+    if (priority == TASK_PRIORITY_HIGH) queue = &pool->urgent;
+    else if (priority == TASK_PRIORITY_IDLE) queue = &pool->idle;
+
+    pthread_mutex_lock(&pool->mutex);
+    for (int i = 0; i < count; i++)
+    {
+        task.arg = (unsigned char *)args + i * argSize;
+        if (queue->count == queue->capacity) GrowQueue(queue);
+        queue->tasks[(queue->head + queue->count) & (queue->capacity - 1)] = task;
+        __atomic_add_fetch(&queue->count, 1, __ATOMIC_SEQ_CST);
+    }
+    if (pool->sleepers) pthread_cond_broadcast(&pool->task_available);
+    if (pool->waiters) pthread_cond_broadcast(&pool->tasks_done);
+    pthread_mutex_unlock(&pool->mutex);
+}
+
+// Returns once busy(arg) turns false. Meanwhile the caller runs queued tasks
+// of group and its descendants, so a task waiting on its subtasks never stalls
+// them, but nothing else: an unrelated task could wait on something further
+// down this very stack. With nothing to run, it sleeps until a task finishes
+// or a new one is queued.
+static void WaitWhileBusy(Threadpool *pool, TaskGroup *group, bool (*busy)(void*), void *arg)
+{
+    Worker *self = (currentWorker && currentWorker->pool == pool) ? currentWorker : NULL;
+    unsigned int rng = 0x2545F491u;
+
+    while (busy(arg))
+    {
+        ThreadpoolTask task;
+
+        if (FindGroupTask(pool, self, group, self ? &self->rng : &rng, &task))
+        {
+            RunTask(pool, task);
+            continue;
+        }
+
+        // Paired with the waiters check in RunTask, so the last task of the
+        // group cannot finish unnoticed between busy() and the wait.
+        pthread_mutex_lock(&pool->mutex);
+        __atomic_add_fetch(&pool->waiters, 1, __ATOMIC_SEQ_CST);
+        if (busy(arg)) pthread_cond_wait(&pool->tasks_done, &pool->mutex);
+        __atomic_sub_fetch(&pool->waiters, 1, __ATOMIC_SEQ_CST);
+        pthread_mutex_unlock(&pool->mutex);
+    }
+}
+
+Threadpool *LoadThreadpool(int nproc)
 {
     int nproc_true = 1;
 
@@ -70,55 +567,366 @@ void InitThreadpool(int nproc)
 
     TRACELOG(LOG_INFO, "Initialized threadpool with %d threads.", nproc);
 
-    threadpoolCount = nproc;
-    threadpool = malloc(sizeof(pthread_t) * threadpoolCount);
+    Threadpool *pool = calloc(1, sizeof(Threadpool));
+    pool->threadCount = nproc;
+    pool->workers = calloc(nproc, sizeof(Worker));
+    pool->running = true;
 
-    running = true;
+    pthread_mutex_init(&pool->mutex, NULL);
+    pthread_cond_init(&pool->task_available, NULL);
+    pthread_cond_init(&pool->tasks_done, NULL);
 
-    pthread_mutex_init(&task_mutex, NULL);
+    for (int i = 0; i < nproc; i++)
+    {
+        pool->workers[i].buffer = NewTaskBuffer(256);
+        pool->workers[i].pool = pool;
+        pool->workers[i].rng = 0x9E3779B9u * (i + 1);
+    }
 
-    for (int i = 0; i < threadpoolCount; i++)
+    for (int i = 0; i < nproc; i++)
     {
-        pthread_create(&threadpool[i], NULL, threadpool_runner, NULL);
+        pthread_create(&pool->workers[i].thread, NULL, threadpool_runner, &pool->workers[i]);
     }
+
+    return pool;
 }
 
-void NewThreadpoolTask(void (*task)(void*), void *arg)
+// Finishes the queued tasks, then stops the workers.
+void UnloadThreadpool(Threadpool *pool)
 {
-    pthread_mutex_lock(&task_mutex);
-    taskCount++;
-    tasks = realloc(tasks, sizeof(ThreadpoolTask) * taskCount);
-    tasks[taskCount - 1] = (ThreadpoolTask){task, arg};
-    pthread_mutex_unlock(&task_mutex);
+    if (!pool) return;
+
+    pthread_mutex_lock(&pool->mutex);
+    pool->running = false;
+    pthread_cond_broadcast(&pool->task_available);
+    pthread_mutex_unlock(&pool->mutex);
+
+    for (int i = 0; i < pool->threadCount; i++)
+    {
+        pthread_join(pool->workers[i].thread, NULL);
+    }
+
+    for (int i = 0; i < pool->threadCount; i++)
+    {
+        TaskBuffer *buffer = pool->workers[i].buffer;
+        while (buffer)
+        {
+            TaskBuffer *retired = buffer->retired;
+            free(buffer);
+            buffer = retired;
+        }
+    }
+
+    pthread_cond_destroy(&pool->task_available);
+    pthread_cond_destroy(&pool->tasks_done);
+    pthread_mutex_destroy(&pool->mutex);
+
+    free(pool->injector.tasks);
+    free(pool->urgent.tasks);
+    free(pool->idle.tasks);
+    free(pool->workers);
+    free(pool);
 }
 
-void WaitForThreadpoolTasksDone(void)
+Threadpool *GetSharedThreadpool(void)
 {
-    int prevTaskCount = 0;
-    while (taskCount) {
-        if (taskCount != prevTaskCount)
+    Threadpool *pool = __atomic_load_n(&sharedPool, __ATOMIC_ACQUIRE);
+
+    if (pool) return pool;
+
+    // Whoever comes second blocks here until the first one has created it.
+    pthread_mutex_lock(&sharedPoolMutex);
+
+    pool = sharedPool;
+    if (!pool)
+    {
+        pool = LoadThreadpool(-1);
+        __atomic_store_n(&sharedPool, pool, __ATOMIC_RELEASE);
+    }
+
+    pthread_mutex_unlock(&sharedPoolMutex);
+
+    return pool;
+}
+
+void CloseSharedThreadpool(void)
+{
+    pthread_mutex_lock(&sharedPoolMutex);
+    Threadpool *pool = __atomic_exchange_n(&sharedPool, NULL, __ATOMIC_ACQ_REL);
+    pthread_mutex_unlock(&sharedPoolMutex);
+
+    UnloadThreadpool(pool);
+}
+
+Threadpool *GetCurrentThreadpool(void)
+{
+    return currentWorker ? currentWorker->pool : GetSharedThreadpool();
+}
+
+void NewThreadpoolTask(Threadpool *pool, void (*task)(void*), void *arg)
+{
+    SubmitTask(pool, (ThreadpoolTask){ task, arg, NULL }, TASK_PRIORITY_NORMAL);
+}
+
+static bool PoolBusy(void *param)
+{
+    return __atomic_load_n(&((Threadpool *)param)->tasksInFlight, __ATOMIC_SEQ_CST) > 0;
+}
+
+void WaitForThreadpoolTasksDone(Threadpool *pool)
+{
+    WaitWhileBusy(pool, NULL, PoolBusy, pool);
+
+    TRACELOG(LOG_INFO, "done.");
+}
+
+int GetThreadpoolTasksLeft(Threadpool *pool)
+{
+    return __atomic_load_n(&pool->tasksInFlight, __ATOMIC_RELAXED);
+}
+
+int GetThreadpoolThreadCount(Threadpool *pool)
+{
+    return pool->threadCount;
+}
+
+TaskGroup NewTaskGroup(Threadpool *pool)
+{
+    return (TaskGroup){ .pool = pool, .parent = currentGroup };
+}
+
+void NewTaskGroupTask(TaskGroup *group, void (*task)(void*), void *arg)
+{
+    ThreadpoolTask newTask = { task, arg, group };
+
+    __atomic_add_fetch(&group->pending, 1, __ATOMIC_RELAXED);
+
+    if (!group->pool)
+    {
+        CallTask(newTask);
+        __atomic_sub_fetch(&group->pending, 1, __ATOMIC_RELAXED);
+        return;
+    }
+
+    SubmitTask(group->pool, newTask, group->priority);
+}
+
+// Claims the next chunk: a share of what is left, so chunks start large and
+// shrink towards grain as the range runs out.
+static bool ClaimTaskRange(TaskRange *range, int *begin, int *end)
+{
+    int next = __atomic_load_n(&range->next, __ATOMIC_RELAXED);
+
+    while (next < range->end)
+    {
+        int size = (range->end - next) / range->divisor;
+        if (size < range->grain) size = range->grain;
+        if (size > range->end - next) size = range->end - next;
+
+        if (__atomic_compare_exchange_n(&range->next, &next, next + size, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
         {
-            TRACELOG(LOG_INFO, "%d tasks left...", taskCount);
-            prevTaskCount = taskCount;
+            *begin = next;
+            *end = next + size;
+            return true;
         }
-        WaitTime(1.0f/60);
     }
-    TRACELOG(LOG_INFO, "done.");
+
+    return false;
 }
 
-int GetThreadpoolTasksLeft(void)
+static void rangecycle(void *param)
 {
-    return taskCount;
+    TaskRange *range = param;
+    int begin, end;
+
+    while (!IsCurrentTaskCancelled() && ClaimTaskRange(range, &begin, &end))
+    {
+        range->fn(begin, end, range->ctx);
+    }
 }
 
-void CloseThreadpool(void)
+void NewTaskGroupRange(TaskGroup *group, TaskRange *range, int begin, int end, int grain, void (*fn)(int begin, int end, void *ctx), void *ctx)
 {
-    running = false;
-    for (int i = 0; i < threadpoolCount; i++)
+    int threadCount = group->pool ? group->pool->threadCount : 1;
+
+    *range = (TaskRange){ .fn = fn, .ctx = ctx, .next = begin, .end = end, .grain = grain > 0 ? grain : 1, .divisor = 2 * threadCount };
+
+    if (end <= begin) return;
+
+    // One task per thread at most; each keeps claiming chunks until none are left.
+    int chunks = (end - begin + range->grain - 1) / range->grain;
+    int taskCount = chunks < threadCount ? chunks : threadCount;
+
+    if (!group->pool)
     {
-        pthread_join(threadpool[i], NULL);
+        NewTaskGroupTask(group, rangecycle, range);
+        return;
     }
-    free(tasks);
-    free(threadpool);
-    pthread_mutex_destroy(&task_mutex);
+
+    __atomic_add_fetch(&group->pending, taskCount, __ATOMIC_RELAXED);
+    SubmitTaskBatch(group->pool, (ThreadpoolTask){ rangecycle, NULL, group }, range, 0, taskCount, group->priority);
+}
+
+static bool GroupBusy(void *param)
+{
+    return __atomic_load_n(&((TaskGroup *)param)->pending, __ATOMIC_SEQ_CST) > 0;
+}
+
+void WaitForTaskGroup(TaskGroup *group)
+{
+    if (group->pool) WaitWhileBusy(group->pool, group, GroupBusy, group);
+}
+
+int GetTaskGroupTasksLeft(TaskGroup *group)
+{
+    return __atomic_load_n(&group->pending, __ATOMIC_RELAXED);
+}
+
+void CancelTaskGroup(TaskGroup *group)
+{
+    __atomic_store_n(&group->cancelled, true, __ATOMIC_RELAXED);
+}
+
+bool IsTaskGroupCancelled(TaskGroup *group)
+{
+    for (; group; group = group->parent)
+    {
+        if (__atomic_load_n(&group->cancelled, __ATOMIC_RELAXED)) return true;
+    }
+
+    return false;
+}
+
+bool IsCurrentTaskCancelled(void)
+{
+    return IsTaskGroupCancelled(currentGroup);
+}
+
+void NewTaskFuture(TaskGroup *group, TaskFuture *future, void *(*task)(void*), void *arg)
+{
+    *future = (TaskFuture){ .task = task, .arg = arg, .group = group, .state = TASK_PENDING };
+    NewTaskGroupTask(group, futurecycle, future);
+}
+
+static bool FutureBusy(void *param)
+{
+    return __atomic_load_n(&((TaskFuture *)param)->state, __ATOMIC_SEQ_CST) == TASK_PENDING;
+}
+
+void *WaitForTaskFuture(TaskFuture *future)
+{
+    if (future->group->pool) WaitWhileBusy(future->group->pool, future->group, FutureBusy, future);
+
+    return future->state == TASK_DONE ? future->result : NULL;
+}
+
+bool IsTaskFutureDone(TaskFuture *future)
+{
+    return !FutureBusy(future);
+}
+
+typedef struct ParallelChunk {
+    void (*fn)(int begin, int end, void *ctx, void *partial);
+    void *ctx;
+    void *partial;
+    int begin, end;
+} ParallelChunk;
+
+static void parallelcycle(void *param)
+{
+    ParallelChunk *chunk = param;
+
+    chunk->fn(chunk->begin, chunk->end, chunk->ctx, chunk->partial);
+}
+
+// Splits [begin, end) into chunks of at least grain items, a few per thread
+// so uneven chunks still balance out. Returns the chunk count.
+static int SplitRange(Threadpool *pool, int begin, int end, int grain, int *chunkSize)
+{
+    int count = end - begin;
+    int maxChunks = pool->threadCount * 4;
+
+    if (grain < 1) grain = 1;
+
+    int chunks = (count + grain - 1) / grain;
+    if (chunks > maxChunks) chunks = maxChunks;
+    if (pool->threadCount == 1 || chunks < 1) chunks = 1;
+
+    *chunkSize = (count + chunks - 1) / chunks;
+    return (count + *chunkSize - 1) / *chunkSize;
+}
+
+static void RunChunks(Threadpool *pool, ParallelChunk *chunks, int chunkCount)
+{
+    TaskGroup group = NewTaskGroup(pool);
+
+    // The caller takes the first chunk itself instead of sitting idle.
+    __atomic_add_fetch(&group.pending, chunkCount - 1, __ATOMIC_RELAXED);
+    SubmitTaskBatch(pool, (ThreadpoolTask){ parallelcycle, NULL, &group }, chunks + 1, sizeof(ParallelChunk), chunkCount - 1, TASK_PRIORITY_NORMAL);
+    parallelcycle(&chunks[0]);
+
+    WaitForTaskGroup(&group);
+}
+
+void ParallelFor(int begin, int end, int grain, void (*fn)(int begin, int end, void *ctx), void *ctx)
+{
+    if (end <= begin) return;
+
+    Threadpool *pool = GetCurrentThreadpool();
+
+    if (pool->threadCount == 1 || end - begin <= grain)
+    {
+        fn(begin, end, ctx);
+        return;
+    }
+
+    TaskGroup group = NewTaskGroup(pool);
+    TaskRange range;
+
+    NewTaskGroupRange(&group, &range, begin, end, grain, fn, ctx);
+
+    // The caller claims chunks too instead of sitting idle.
+    int chunkBegin, chunkEnd;
+    while (ClaimTaskRange(&range, &chunkBegin, &chunkEnd)) fn(chunkBegin, chunkEnd, ctx);
+
+    WaitForTaskGroup(&group);
+}
+
+void ParallelReduce(int begin, int end, int grain, void *result, size_t resultSize,
+                    void (*fn)(int begin, int end, void *ctx, void *partial),
+                    void (*join)(void *result, void *partial, void *ctx), void *ctx)
+{
+    if (end <= begin) return;
+
+    Threadpool *pool = GetCurrentThreadpool();
+    int chunkSize;
+    int chunkCount = SplitRange(pool, begin, end, grain, &chunkSize);
+
+    if (chunkCount == 1)
+    {
+        fn(begin, end, ctx, result);
+        return;
+    }
+
+    ParallelChunk *chunks = malloc(sizeof(ParallelChunk) * chunkCount);
+    unsigned char *partials = malloc(resultSize * chunkCount);
+
+    // Every partial starts as a copy of the initial result, so that has to be
+    // the identity of join.
+    for (int i = 0; i < chunkCount; i++)
+    {
+        int chunkBegin = begin + i * chunkSize;
+        int chunkEnd = end - chunkBegin > chunkSize ? chunkBegin + chunkSize : end;
+
+        memcpy(partials + i * resultSize, result, resultSize);
+        chunks[i] = (ParallelChunk){ .fn = fn, .ctx = ctx, .partial = partials + i * resultSize, .begin = chunkBegin, .end = chunkEnd };
+    }
+
+    RunChunks(pool, chunks, chunkCount);
+
+    // Joined in range order, so order-dependent results stay deterministic.
+    for (int i = 0; i < chunkCount; i++) join(result, partials + i * resultSize, ctx);
+
+    free(partials);
+    free(chunks);
 }
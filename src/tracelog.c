@@ -83,6 +83,8 @@ void OpenSC5_TraceLog(int logLevel, const char *text, ...)
     // originally we used printf, so every log message ended with a newline
     // TraceLog by default ends every line with a newline, so we need to remove it.
 
+    if (logLevel < logTypeLevel) return; 
+
     char *ourText = strdup(text);
 
     if (ourText[strlen(text) - 1] == '\n')
@@ -90,8 +92,6 @@ void OpenSC5_TraceLog(int logLevel, const char *text, ...)
         ourText[strlen(text) - 1] = 0;
     }
 
-    if (logLevel < logTypeLevel) return; 
-
     tl_prep();
 
     va_list args;
@@ -101,6 +101,8 @@ void OpenSC5_TraceLog(int logLevel, const char *text, ...)
 
     va_end(args);
 
+    free(ourText);
+
     tl_end();
 }
 
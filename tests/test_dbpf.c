@@ -1,11 +1,99 @@
 #include "filetypes/package.h"
+#include "filetypes/refpack.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
 
+// Compresses a file at every level and checks it round-trips through DecompressDBPF.
+static int TestCompress(const char *filename)
+{
+    int dataSize;
+    unsigned char *data = LoadFileData(filename, &dataSize);
+
+    if (!data) return 1;
+
+    unsigned char *compressed = malloc(refpack_compress_bound(dataSize));
+    const char *levels[] = { "", "fast", "balanced", "max" };
+
+    for (int level = REFPACK_FAST; level <= REFPACK_MAX; level++)
+    {
+        clock_t start = clock();
+        ptrdiff_t compressedSize = refpack_compress(data, dataSize, compressed, refpack_compress_bound(dataSize), level);
+        double time = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+        unsigned char *roundTrip = DecompressDBPF(compressed, compressedSize, dataSize);
+
+        if (!roundTrip || memcmp(roundTrip, data, dataSize))
+        {
+            printf("%s: round trip failed at level %s.\n", filename, levels[level]);
+            return 1;
+        }
+
+        printf("%-8s %d -> %td bytes (%.1f%%), %.1f MB/s\n", levels[level], dataSize, compressedSize,
+            100.0 * compressedSize / dataSize, dataSize / (1024 * 1024 * (time > 0 ? time : 1e-9)));
+        free(roundTrip);
+    }
+
+    free(compressed);
+    UnloadFileData(data);
+
+    return 0;
+}
+
+// Usage: test_dbpf <refpack stream> [iterations]
+//        test_dbpf -compress <file>
+// Decodes the stream with both RefPack decoders, checks they agree and prints
+// their throughput.
 int main(int argc, char **argv)
 {
+    if (argc < 2)
+    {
+        printf("Usage: %s <refpack stream> [iterations]\n", argv[0]);
+        printf("       %s -compress <file>\n", argv[0]);
+        return 1;
+    }
+
+    if (!strcmp(argv[1], "-compress") && argc > 2) return TestCompress(argv[2]);
+
     int dataSize;
     unsigned char *data = LoadFileData(argv[1], &dataSize);
+    int iterations = argc > 2 ? atoi(argv[2]) : 100;
+    size_t headerSize, outSize;
+
+    if (!data || !refpack_header(data, dataSize, &headerSize, &outSize))
+    {
+        printf("%s: not a RefPack stream.\n", argv[1]);
+        return 1;
+    }
+
+    unsigned char *expected = malloc(outSize);
+    unsigned char *out = malloc(outSize);
+
+    refpack_decompress_unsafe(data, NULL, expected);
+
+    if (refpack_decompress(data, dataSize, out, outSize) != outSize || memcmp(out, expected, outSize))
+    {
+        printf("Decoders disagree on %s.\n", argv[1]);
+        return 1;
+    }
+
+    clock_t start = clock();
+    for (int i = 0; i < iterations; i++) refpack_decompress_unsafe(data, NULL, expected);
+    double unsafeTime = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    start = clock();
+    for (int i = 0; i < iterations; i++) refpack_decompress(data, dataSize, out, outSize);
+    double safeTime = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    double mb = (double)outSize * iterations / (1024 * 1024);
+    printf("%d -> %zu bytes, %d iterations\n", dataSize, outSize, iterations);
+    printf("refpack_decompress_unsafe: %8.1f MB/s\n", mb / unsafeTime);
+    printf("refpack_decompress:        %8.1f MB/s (%.2fx)\n", mb / safeTime, unsafeTime / safeTime);
 
-    DecompressDBPF(data, dataSize, 1009);
+    free(out);
+    free(expected);
+    UnloadFileData(data);
 
     return 0;
 }
@@ -1,13 +1,23 @@
 #include "hash.h"
 #include <stdio.h>
+#include <stdlib.h>
 
 int main(int argc, char **argv)
 {
+    uint32_t *hashes = malloc(sizeof(uint32_t) * argc);
+    int bad = 0;
+
+    TheHashBatch((const char *const *)argv + 1, NULL, argc - 1, hashes);
+
     for (int i = 1; i < argc; i++)
     {
         printf("\"%s\" -> %#lx\n", argv[i], TheHash(argv[i]));
+        if (hashes[i - 1] != TheHash(argv[i])) bad++;
     }
 
-    return 0;
-}
+    if (bad) printf("%d batch hashes differ\n", bad);
 
+    free(hashes);
+
+    return bad != 0;
+}
@@ -1,10 +1,302 @@
 #include "filetypes/package.h"
+#include "filetypes/pkgstream.h"
+#include "filetypes/pkgdedup.h"
+#include "filetypes/entrycache.h"
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <raylib.h>
 
+#ifdef _WIN32
+#include <cpl_raylib.h>
+#else
+#include <time.h>
+#include <fcntl.h>
+#endif
+
+static double NowSeconds(void)
+{
+#ifdef _WIN32
+    LARGE_INTEGER count, freq;
+    QueryPerformanceCounter(&count);
+    QueryPerformanceFrequency(&freq);
+    return (double)count.QuadPart / freq.QuadPart;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+#endif
+}
+
+// Asks the OS to drop the file from the page cache. Returns false where that
+// is not possible, in which case "cold" runs are really warm.
+static bool DropFileCache(FILE *f)
+{
+#if defined(POSIX_FADV_DONTNEED)
+    return posix_fadvise(fileno(f), 0, 0, POSIX_FADV_DONTNEED) == 0;
+#else
+    return false;
+#endif
+}
+
+static double TimeLoad(FILE *f, int flags, bool cold)
+{
+    if (cold) DropFileCache(f);
+    rewind(f);
+
+    double start = NowSeconds();
+    Package pkg = LoadPackageFileEx(f, flags);
+    double time = NowSeconds() - start;
+
+    UnloadPackageFile(pkg);
+    return time;
+}
+
+// Compares the ways of reading a package's chunks, with the file dropped from
+// the page cache before each run (cold) and with it cached (warm).
+static void Benchmark(FILE *f, int runs)
+{
+    struct { const char *name; int flags; } modes[] = {
+        { "fseek/fread + lock", PKGLOAD_STDIO },
+        { "pread", 0 },
+        { "mmap", PKGLOAD_MMAP },
+    };
+
+    SetWriteCorruptedPackageEntries(false);
+
+    if (!DropFileCache(f)) printf("Cannot drop the page cache here; cold numbers are warm.\n");
+
+    for (int i = 0; i < sizeof(modes) / sizeof(modes[0]); i++)
+    {
+        double cold = 0, warm = 0;
+
+        for (int run = 0; run < runs; run++) cold += TimeLoad(f, modes[i].flags, true);
+        for (int run = 0; run < runs; run++) warm += TimeLoad(f, modes[i].flags, false);
+
+        printf("%-20s cold %8.2f ms  warm %8.2f ms\n", modes[i].name, cold * 1000 / runs, warm * 1000 / runs);
+    }
+}
+
+typedef struct ScanStats {
+    int entries;
+    int corrupted;
+    long long rawSize;
+} ScanStats;
+
+static bool CountEntry(PackageEntry *entry, void *ctx)
+{
+    ScanStats *stats = ctx;
+
+    stats->entries++;
+    stats->corrupted += entry->corrupted;
+    stats->rawSize += entry->dataRawSize;
+    return true;
+}
+
+// Streams every package given, so whole mirrors can be checked without
+// keeping their entries around.
+static int Scan(char **filenames, int count)
+{
+    ScanStats total = { 0 };
+
+    SetWriteCorruptedPackageEntries(false);
+
+    for (int i = 0; i < count; i++)
+    {
+        FILE *f = fopen(filenames[i], "rb");
+        ScanStats stats = { 0 };
+
+        if (!f)
+        {
+            perror(filenames[i]);
+            continue;
+        }
+
+        ScanPackageFile(f, CountEntry, &stats);
+        fclose(f);
+
+        printf("%s: %d entries, %d corrupted, %lld bytes\n", filenames[i], stats.entries, stats.corrupted, stats.rawSize);
+        total.entries += stats.entries;
+        total.corrupted += stats.corrupted;
+        total.rawSize += stats.rawSize;
+    }
+
+    printf("Total: %d entries, %d corrupted, %lld bytes\n", total.entries, total.corrupted, total.rawSize);
+
+    return 0;
+}
+
+// Loads every package given at once and reports how many of their entries
+// decoded to data another entry already held.
+static int Dedup(char **filenames, int count)
+{
+    Package *pkgs = calloc(count, sizeof(Package));
+    int entries = 0;
+
+    SetWriteCorruptedPackageEntries(false);
+    SetDeduplicatePackageEntries(true);
+
+    for (int i = 0; i < count; i++)
+    {
+        FILE *f = fopen(filenames[i], "rb");
+
+        if (!f)
+        {
+            perror(filenames[i]);
+            continue;
+        }
+
+        pkgs[i] = LoadPackageFileEx(f, PKGLOAD_MMAP);
+        entries += pkgs[i].entryCount;
+        fclose(f);
+    }
+
+    PackageDedupStats stats = GetPackageDedupStats();
+
+    printf("%d entries, %lu compressed, %lu duplicates sharing %d decodes, %zu bytes saved, %lu hash collisions\n",
+           entries, stats.lookups, stats.duplicates, stats.sharedCount, stats.savedBytes, stats.collisions);
+
+    for (int i = 0; i < count; i++) UnloadPackageFile(pkgs[i]);
+    free(pkgs);
+
+    return 0;
+}
+
+static bool IsInMapping(MappedFile mapping, const unsigned char *data)
+{
+    return data >= mapping.data && data < mapping.data + mapping.size;
+}
+
+// Checks that a mapped package keeps its compressed bytes in the mapping
+// only: by default nothing goes through the dedup table, and with dedup on
+// shared entries point at a chunk instead of copying it.
+static int ZeroCopy(const char *filename)
+{
+    FILE *f = fopen(filename, "rb");
+    int bad = 0;
+
+    if (!f)
+    {
+        perror(filename);
+        return 1;
+    }
+
+    SetWriteCorruptedPackageEntries(false);
+
+    for (int dedup = 0; dedup < 2; dedup++)
+    {
+        PackageDedupStats before = GetPackageDedupStats();
+
+        if (dedup) SetDeduplicatePackageEntries(true);
+
+        rewind(f);
+        Package pkg = LoadPackageFileEx(f, PKGLOAD_MMAP);
+        PackageDedupStats after = GetPackageDedupStats();
+
+        if (!dedup && (after.lookups != before.lookups || after.sharedCount != before.sharedCount)) bad++;
+
+        for (unsigned int i = 0; i < pkg.entryCount; i++)
+        {
+            PackageEntry *entry = &pkg.entries[i];
+
+            if (!entry->compressed || !entry->dataCompressed) continue;
+            if (!IsInMapping(pkg.mapping, entry->dataCompressed)) bad++;
+            if (!dedup && entry->shared) bad++;
+            if (entry->shared && entry->shared->dataCompressed && !IsInMapping(pkg.mapping, entry->shared->dataCompressed)) bad++;
+        }
+
+        printf("dedup %s: %lu lookups, %d shared entries\n", dedup ? "on" : "off", after.lookups - before.lookups, after.sharedCount);
+
+        UnloadPackageFile(pkg);
+
+        // Every shared entry goes with the last package using it.
+        if (GetPackageDedupStats().sharedCount) bad++;
+    }
+
+    SetDeduplicatePackageEntries(false);
+    fclose(f);
+
+    printf("%s\n", bad ? "FAILED" : "OK");
+
+    return bad != 0;
+}
+
+// Loads the package twice, so every TGI is in two packages, and goes through
+// both copies with a small cache budget. Every decoded entry has to be
+// tracked by the cache, and the cache has to end up within budget.
+static int CacheBudget(const char *filename)
+{
+    FILE *f = fopen(filename, "rb");
+    Package pkgs[2];
+    size_t budget = 256 * 1024;
+
+    if (!f)
+    {
+        perror(filename);
+        return 1;
+    }
+
+    SetWriteCorruptedPackageEntries(false);
+    SetEntryCacheBudget(budget);
+
+    for (int p = 0; p < 2; p++)
+    {
+        rewind(f);
+        pkgs[p] = LoadPackageFileEx(f, PKGLOAD_LAZY);
+    }
+
+    for (unsigned int i = 0; i < pkgs[0].entryCount; i++)
+    {
+        for (int p = 0; p < 2; p++) ReleasePackageEntryData(AcquirePackageEntryData(pkgs[p], i));
+    }
+
+    TrimEntryCache();
+
+    EntryCacheStats stats = GetEntryCacheStats();
+    size_t loaded = 0;
+
+    for (int p = 0; p < 2; p++)
+    {
+        for (unsigned int i = 0; i < pkgs[p].entryCount; i++)
+        {
+            if (pkgs[p].entries[i].loadState == PKGENTRY_LOADED) loaded += GetPackageEntryDataSize(&pkgs[p].entries[i]);
+        }
+    }
+
+    // Entries whose data is not decoded (corrupted ones) stay loaded at no cost.
+    bool ok = stats.size <= budget && loaded == stats.size && !stats.pinnedCount;
+
+    printf("%lu hits, %lu misses, %lu evictions, %zu of %zu bytes cached, %zu bytes decoded: %s\n",
+           stats.hits, stats.misses, stats.evictions, stats.size, budget, loaded, ok ? "OK" : "FAILED");
+
+    for (int p = 0; p < 2; p++)
+    {
+        RemovePackageFromEntryCache(pkgs[p]);
+        UnloadPackageFile(pkgs[p]);
+    }
+
+    fclose(f);
+
+    return !ok;
+}
+
+// Usage: test_package <file.package>
+//        test_package -bench <file.package> [runs]
+//        test_package -scan <file.package>...
+//        test_package -dedup <file.package>...
+//        test_package -zerocopy <file.package>
+//        test_package -cache <file.package>
 int main(int argc, char **argv)
 {
-    FILE *f = fopen(argv[1], "rb");
+    if (argc > 2 && !strcmp(argv[1], "-cache")) return CacheBudget(argv[2]);
+    if (argc > 2 && !strcmp(argv[1], "-zerocopy")) return ZeroCopy(argv[2]);
+    if (argc > 2 && !strcmp(argv[1], "-scan")) return Scan(argv + 2, argc - 2);
+    if (argc > 2 && !strcmp(argv[1], "-dedup")) return Dedup(argv + 2, argc - 2);
+
+    bool bench = argc > 2 && !strcmp(argv[1], "-bench");
+    const char *filename = bench ? argv[2] : argv[1];
+
+    FILE *f = fopen(filename, "rb");
 
     if (!f)
     {
@@ -12,10 +304,10 @@ int main(int argc, char **argv)
         return 1;
     }
 
-    LoadPackageFile(f);
+    if (bench) Benchmark(f, argc > 3 ? atoi(argv[3]) : 5);
+    else LoadPackageFile(f);
 
     fclose(f);
 
     return 0;
 }
-